@@ -0,0 +1,220 @@
+#include "AbilityPredictor.h"
+#include "CCBot.h"
+#include <algorithm>
+
+#ifdef SC2API
+namespace
+{
+    // the tech tree lists alternatives, owning one of them is enough, so it can not say that these need both
+    // a tech lab on the producer and a tech building. the game is always asked about them instead
+    bool HasUnlistedRequirements(const sc2::UnitTypeID & type)
+    {
+        switch (type.ToType())
+        {
+            case sc2::UNIT_TYPEID::TERRAN_GHOST:            // barracks tech lab and ghost academy
+            case sc2::UNIT_TYPEID::TERRAN_THOR:             // factory tech lab and armory
+            case sc2::UNIT_TYPEID::TERRAN_BATTLECRUISER:    // starport tech lab and fusion core
+                return true;
+            default:
+                return false;
+        }
+    }
+}
+#endif
+
+AbilityPredictor::AbilityPredictor(CCBot & bot)
+    : m_bot(bot)
+{
+
+}
+
+bool AbilityPredictor::hasUpgrade(const CCUpgrade & upgrade) const
+{
+#ifdef SC2API
+    const size_t id = (size_t)(uint32_t)upgrade;
+#else
+    const size_t id = (size_t)upgrade.getID();
+#endif
+    return id < m_upgrades.size() && m_upgrades[id];
+}
+
+bool AbilityPredictor::isAbilityActive(uint32_t ability) const
+{
+    return ability < m_activeAbilities.size() && m_activeAbilities[ability];
+}
+
+bool AbilityPredictor::hasRequiredUnit(const std::vector<UnitType> & requiredUnits) const
+{
+    if (requiredUnits.empty())
+    {
+        return true;
+    }
+
+    for (auto & required : requiredUnits)
+    {
+        if (m_bot.UnitInfo().getUnitTypeCount(Players::Self, required, true) > 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void AbilityPredictor::update()
+{
+#ifdef SC2API
+    std::fill(m_upgrades.begin(), m_upgrades.end(), false);
+    for (auto & upgrade : m_bot.Observation()->GetUpgrades())
+    {
+        const size_t id = (size_t)(uint32_t)upgrade;
+        if (id >= m_upgrades.size()) { m_upgrades.resize(id + 1, false); }
+        m_upgrades[id] = true;
+    }
+
+    std::fill(m_activeAbilities.begin(), m_activeAbilities.end(), false);
+    for (auto & unit : m_bot.UnitInfo().getUnits(Players::Self))
+    {
+        for (auto & order : unit.getUnitPtr()->orders)
+        {
+            const size_t id = (size_t)(uint32_t)order.ability_id;
+            if (id >= m_activeAbilities.size()) { m_activeAbilities.resize(id + 1, false); }
+            m_activeAbilities[id] = true;
+        }
+    }
+
+    m_answers.clear();
+    if (m_pending.empty())
+    {
+        return;
+    }
+
+    sc2::Units producers;
+    for (auto & producer : m_pending)
+    {
+        if (producer.isValid() && producer.isAlive())
+        {
+            producers.push_back(producer.getUnitPtr());
+        }
+    }
+    m_pending.clear();
+
+    if (producers.empty())
+    {
+        return;
+    }
+
+    // resources are checked by the production manager against its own reserves, so the query ignores them
+    for (auto & available : m_bot.Query()->GetAbilitiesForUnits(producers, true))
+    {
+        auto & abilities = m_answers[available.unit_tag];
+        const size_t typeIndex = UnitType(available.unit_type_id, m_bot).getIndex();
+        for (auto & ability : available.abilities)
+        {
+            abilities.push_back((uint32_t)ability.ability_id);
+            m_confirmed.insert(std::make_pair(typeIndex, (uint32_t)ability.ability_id));
+        }
+    }
+#endif
+}
+
+int AbilityPredictor::predict(const Unit & producer, const MetaType & type) const
+{
+#ifdef SC2API
+    if (!producer.isValid() || !producer.isCompleted() || producer.getPlayer() != Players::Self)
+    {
+        return Prediction::No;
+    }
+
+    const TypeData & data = m_bot.Data(type);
+    const uint32_t ability = (uint32_t)data.buildAbility;
+    const sc2::Unit * unit = producer.getUnitPtr();
+    const UnitType producerType = producer.getType();
+
+    // nothing with no build ability can be made, and lifted buildings can not make anything
+    if (ability == 0 || (producerType.isBuilding() && producer.isFlying()))
+    {
+        return Prediction::No;
+    }
+
+    for (auto & upgrade : data.requiredUpgrades)
+    {
+        if (!hasUpgrade(upgrade)) { return Prediction::No; }
+    }
+
+    // a tech lab requirement is met by the producer's own addon, not by any tech lab we own
+    const bool needsTechLab = std::any_of(data.requiredUnits.begin(), data.requiredUnits.end(), [](const UnitType & t) { return t.isTechLab(); });
+    const Unit addon = unit->add_on_tag != sc2::NullTag ? m_bot.GetUnit(unit->add_on_tag) : Unit();
+    if (needsTechLab)
+    {
+        if (!addon.isValid() || !addon.getType().isTechLab()) { return Prediction::No; }
+    }
+    else if (!hasRequiredUnit(data.requiredUnits))
+    {
+        return Prediction::No;
+    }
+
+    if (type.isUpgrade())
+    {
+        // the research ability goes away while any of our units researches the upgrade, and for good once it is done
+        if (hasUpgrade(type.getUpgrade()) || isAbilityActive(ability)) { return Prediction::No; }
+        if (!unit->orders.empty()) { return Prediction::Unknown; }
+    }
+    else if (type.isAddon())
+    {
+        if (addon.isValid()) { return Prediction::No; }
+        if (!unit->orders.empty()) { return Prediction::Unknown; }
+    }
+    else if (type.getUnitType().isMorphedBuilding())
+    {
+        if (!unit->orders.empty()) { return Prediction::Unknown; }
+    }
+    else if (!type.isBuilding())
+    {
+        if (data.supplyCost > m_bot.GetMaxSupply() - m_bot.GetCurrentSupply()) { return Prediction::No; }
+
+        // production buildings queue five orders, eight with a reactor
+        const size_t queueSize = addon.isValid() && addon.getType().isReactor() ? 8 : 5;
+        if (producerType.isBuilding() && unit->orders.size() >= queueSize) { return Prediction::No; }
+    }
+
+    if (type.isUnit() && HasUnlistedRequirements(type.getUnitType().getAPIUnitType()))
+    {
+        return Prediction::Unknown;
+    }
+
+    if (m_confirmed.find(std::make_pair(producerType.getIndex(), ability)) == m_confirmed.end())
+    {
+        return Prediction::Unknown;
+    }
+
+    return Prediction::Yes;
+#else
+    return Prediction::Unknown;
+#endif
+}
+
+bool AbilityPredictor::canMake(const Unit & producer, const MetaType & type)
+{
+    const int prediction = predict(producer, type);
+    if (prediction != Prediction::Unknown)
+    {
+        return prediction == Prediction::Yes;
+    }
+
+    auto it = m_answers.find(producer.getID());
+    if (it != m_answers.end())
+    {
+#ifdef SC2API
+        const uint32_t ability = (uint32_t)m_bot.Data(type).buildAbility;
+        return std::find(it->second.begin(), it->second.end(), ability) != it->second.end();
+#endif
+    }
+
+    if (std::find(m_pending.begin(), m_pending.end(), producer) == m_pending.end())
+    {
+        m_pending.push_back(producer);
+    }
+
+    return false;
+}
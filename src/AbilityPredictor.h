@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Common.h"
+#include "Unit.h"
+#include "MetaType.h"
+#include "FlatUnitMap.h"
+#include <set>
+
+class CCBot;
+
+namespace Prediction
+{
+    enum { No, Yes, Unknown };
+}
+
+// Answers whether a producer can make a type right now without asking the game
+// the answer comes from the tech tree requirements, the upgrades we own and are researching,
+// the producer's orders and addon, which covers nearly every call from the production loop.
+// when the local state is not enough to be sure, the producer is remembered and all of them are
+// sent to the game in a single GetAbilitiesForUnits query at the start of the next production pass.
+// only pairs of producer type and ability the game has offered at least once are ever predicted as possible,
+// and types whose requirements the tech tree can not list in full are never predicted as possible, only ruled out
+class AbilityPredictor
+{
+    CCBot &                                 m_bot;
+
+    std::vector<bool>                       m_upgrades;         // by upgrade id, upgrades we have
+    std::vector<bool>                       m_activeAbilities;  // by ability id, abilities in the orders of any of our units
+    std::set<std::pair<size_t, uint32_t>>   m_confirmed;        // unit type index and ability id pairs the game has offered
+
+    FlatUnitMap<CCUnitID, std::vector<uint32_t>> m_answers;     // abilities of the producers queried this pass
+    std::vector<Unit>                       m_pending;          // producers to query in the next pass
+
+    bool    hasUpgrade(const CCUpgrade & upgrade) const;
+    bool    isAbilityActive(uint32_t ability) const;
+    bool    hasRequiredUnit(const std::vector<UnitType> & requiredUnits) const;
+    int     predict(const Unit & producer, const MetaType & type) const;
+
+public:
+
+    AbilityPredictor(CCBot & bot);
+
+    // refreshes our upgrades and orders, and sends the producers left uncertain last pass to the game in one query
+    void    update();
+
+    // true if the producer can make the type now, false if it can not or can not be known until the next pass
+    bool    canMake(const Unit & producer, const MetaType & type);
+};
@@ -0,0 +1,81 @@
+#include "BaseDistanceTable.h"
+#include "BaseLocation.h"
+#include <algorithm>
+
+BaseDistanceTable::BaseDistanceTable()
+{
+
+}
+
+void BaseDistanceTable::build(const std::vector<const BaseLocation *> & bases)
+{
+    m_bases = bases;
+    const int numBases = (int)m_bases.size();
+
+    for (int i(0); i < numBases; ++i)
+    {
+        BOT_ASSERT(m_bases[i]->getBaseID() == i, "Base IDs should match their index: %d != %d", m_bases[i]->getBaseID(), i);
+    }
+
+    m_distances.reset(numBases, numBases, -1);
+    for (int from(0); from < numBases; ++from)
+    {
+        for (int to(0); to < numBases; ++to)
+        {
+            m_distances(from, to) = m_bases[from]->getGroundDistance(m_bases[to]->getDepotPosition());
+        }
+    }
+
+    m_basesByDistance.assign(numBases, std::vector<const BaseLocation *>());
+    for (int from(0); from < numBases; ++from)
+    {
+        auto & sorted = m_basesByDistance[from];
+        for (int to(0); to < numBases; ++to)
+        {
+            if (to != from && m_distances(from, to) >= 0)
+            {
+                sorted.push_back(m_bases[to]);
+            }
+        }
+
+        // stable so bases at the same distance keep their base ID order
+        std::stable_sort(sorted.begin(), sorted.end(), [this, from](const BaseLocation * a, const BaseLocation * b)
+        {
+            return m_distances(from, a->getBaseID()) < m_distances(from, b->getBaseID());
+        });
+    }
+}
+
+size_t BaseDistanceTable::getIndex(const BaseLocation * base) const
+{
+    BOT_ASSERT(base != nullptr && base->getBaseID() >= 0 && base->getBaseID() < (int)m_bases.size(), "Base is not in the distance table");
+    return (size_t)base->getBaseID();
+}
+
+int BaseDistanceTable::getGroundDistance(const BaseLocation * from, const BaseLocation * to) const
+{
+    return m_distances(getIndex(from), getIndex(to));
+}
+
+const std::vector<const BaseLocation *> & BaseDistanceTable::getBasesByDistance(const BaseLocation * from) const
+{
+    return m_basesByDistance[getIndex(from)];
+}
+
+const BaseLocation * BaseDistanceTable::getClosestBaseLocation(const CCPosition & pos) const
+{
+    const BaseLocation * closestBase = nullptr;
+    int minDistance = std::numeric_limits<int>::max();
+
+    for (const BaseLocation * base : m_bases)
+    {
+        int distance = base->getGroundDistance(pos);
+        if (distance >= 0 && distance < minDistance)
+        {
+            closestBase = base;
+            minDistance = distance;
+        }
+    }
+
+    return closestBase;
+}
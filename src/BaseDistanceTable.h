@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Common.h"
+#include "Grid2D.h"
+
+class BaseLocation;
+
+// Ground distances between every pair of base locations, computed once at game start
+// each base already owns a shared, pinned DistanceMap, so this only samples those maps
+// and orders the bases by distance from one another for expansion and scouting decisions
+class BaseDistanceTable
+{
+    std::vector<const BaseLocation *>               m_bases;            // indexed by base ID
+    Grid2D<int>                                     m_distances;        // (from, to) = ground distance from one base to the depot of another, -1 if not connected
+    std::vector<std::vector<const BaseLocation *>>  m_basesByDistance;  // for each base, every other connected base sorted closest first
+
+    size_t getIndex(const BaseLocation * base) const;
+
+public:
+
+    BaseDistanceTable();
+
+    void build(const std::vector<const BaseLocation *> & bases);
+
+    int getGroundDistance(const BaseLocation * from, const BaseLocation * to) const;
+    const std::vector<const BaseLocation *> & getBasesByDistance(const BaseLocation * from) const;
+    const BaseLocation * getClosestBaseLocation(const CCPosition & pos) const;
+};
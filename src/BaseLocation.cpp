@@ -8,6 +8,7 @@ const int NearBaseLocationTileDistance = 20;
 
 BaseLocation::BaseLocation(CCBot & bot, int baseID, const std::vector<Unit> & resources)
     : m_bot(bot)
+    , m_distanceMap          (nullptr)
     , m_baseID               (baseID)
     , m_isStartLocation      (false)
     , m_left                 (std::numeric_limits<CCPositionType>::max())
@@ -70,7 +71,8 @@ BaseLocation::BaseLocation(CCBot & bot, int baseID, const std::vector<Unit> & re
 
     // compute this BaseLocation's DistanceMap, which will compute the ground distance
     // from the center of its recourses to every other tile on the map
-    m_distanceMap = m_bot.Map().getDistanceMap(m_centerOfResources);
+    // it is pinned in the map's cache so every user shares the one copy and it is never evicted
+    m_distanceMap = &m_bot.Map().pinDistanceMap(Util::GetTilePosition(m_centerOfResources));
 
     // check to see if this is a start location for the map
     for (auto & pos : m_bot.GetStartLocations())
@@ -112,17 +114,33 @@ BaseLocation::BaseLocation(CCBot & bot, int baseID, const std::vector<Unit> & re
 #endif
         
         // the position of the depot will be the closest spot we can build one from the resource center
-        for (auto & tile : getClosestTiles())
+        // tiles are checked a batch at a time, so the ones the map can't answer by itself cost one query per batch
+        const size_t batchSize = 64;
+        const std::vector<CCTilePosition> & closestTiles = getClosestTiles();
+        std::vector<CCTilePosition> buildTiles;
+        std::vector<bool> canBuild;
+        bool found = false;
+
+        for (size_t start(0); start < closestTiles.size() && !found; start += batchSize)
         {
-            // the build position will be up-left of where this tile is
-            // this means we are positioning the center of the resouce depot
-            CCTilePosition buildTile(tile.x - offsetX, tile.y - offsetY);
+            buildTiles.clear();
+            for (size_t i(start); i < closestTiles.size() && i < start + batchSize; ++i)
+            {
+                // the build position will be up-left of where this tile is
+                // this means we are positioning the center of the resouce depot
+                buildTiles.push_back(CCTilePosition(closestTiles[i].x - offsetX, closestTiles[i].y - offsetY));
+            }
 
-            if (m_bot.Map().canBuildTypeAtPosition(buildTile.x, buildTile.y, depot))
+            m_bot.Map().canBuildTypeAtPositions(buildTiles, depot, canBuild);
+            for (size_t i(0); i < buildTiles.size(); ++i)
             {
-                m_depotPosition = buildTile;
-				m_centerOfBase = CCPosition(buildTile.x, buildTile.y);
-                break;
+                if (canBuild[i])
+                {
+                    m_depotPosition = buildTiles[i];
+                    m_centerOfBase = CCPosition(buildTiles[i].x, buildTiles[i].y);
+                    found = true;
+                    break;
+                }
             }
         }
     }
@@ -205,7 +223,7 @@ const int BaseLocation::getNumberOfTurrets() const
 {
 	int turrets = 0;
 	for (auto & unit : m_bot.UnitInfo().getUnits(Players::Self)) {
-		if (unit.getType().getName() == "TERRAN_MISSILETURRET") {
+		if (unit.getType().is(sc2::UNIT_TYPEID::TERRAN_MISSILETURRET)) {
 
 			float closestPosition = 10000;
 			int baseID = 0;
@@ -275,12 +293,12 @@ const CCPosition & BaseLocation::getPosition() const
 
 int BaseLocation::getGroundDistance(const CCPosition & pos) const
 {
-    return m_distanceMap.getDistance(pos);
+    return m_distanceMap->getDistance(pos);
 }
 
 int BaseLocation::getGroundDistance(const CCTilePosition & pos) const
 {
-    return m_distanceMap.getDistance(pos);
+    return m_distanceMap->getDistance(pos);
 }
 
 bool BaseLocation::isStartLocation() const
@@ -291,7 +309,7 @@ bool BaseLocation::isStartLocation() const
 const std::vector<CCTilePosition> & BaseLocation::getClosestTiles() const
 {
 
-    return m_distanceMap.getSortedTiles();
+    return m_distanceMap->getSortedTiles();
 }
 
 void BaseLocation::draw()
@@ -366,7 +384,7 @@ void BaseLocation::draw()
 	*/
 
 
-    m_distanceMap.draw(m_bot);
+    m_distanceMap->draw(m_bot);
 
 }
 
@@ -12,7 +12,7 @@ class CCBot;
 class BaseLocation
 {
     CCBot &                     m_bot;
-    DistanceMap                 m_distanceMap;
+    const DistanceMap *         m_distanceMap;      // shared with the map's distance map cache, where it is pinned
 
 
     CCTilePosition              m_depotPosition;
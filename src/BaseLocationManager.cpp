@@ -11,7 +11,7 @@ BaseLocationManager::BaseLocationManager(CCBot & bot)
 
 void BaseLocationManager::onStart()
 {
-    m_tileBaseLocations = std::vector<std::vector<BaseLocation *>>(m_bot.Map().width(), std::vector<BaseLocation *>(m_bot.Map().height(), nullptr));
+    m_tileBaseLocations.reset(m_bot.Map().width(), m_bot.Map().height(), nullptr);
     m_playerStartingBaseLocations[Players::Self]  = nullptr;
     m_playerStartingBaseLocations[Players::Enemy] = nullptr; 
     
@@ -115,10 +115,13 @@ void BaseLocationManager::onStart()
         }
     }
 
+    // precompute the ground distances between all the bases, these never change during the game
+    m_baseDistances.build(m_baseLocationPtrs);
+
     // construct the map of tile positions to base locations
-    for (int x=0; x < m_bot.Map().width(); ++x)
+    for (int y=0; y < m_bot.Map().height(); ++y)
     {
-        for (int y=0; y < m_bot.Map().height(); ++y)
+        for (int x=0; x < m_bot.Map().width(); ++x)
         {
             for (auto & baseLocation : m_baseLocationData)
             {
@@ -126,7 +129,7 @@ void BaseLocationManager::onStart()
 
                 if (baseLocation.containsPosition(pos))
                 {
-                    m_tileBaseLocations[x][y] = &baseLocation;
+                    m_tileBaseLocations(x, y) = &baseLocation;
                     
                     break;
                 }
@@ -258,9 +261,9 @@ BaseLocation * BaseLocationManager::getBaseLocation(const CCPosition & pos) cons
     if (!m_bot.Map().isValidPosition(pos)) { return nullptr; }
 
 #ifdef SC2API
-    return m_tileBaseLocations[(int)pos.x][(int)pos.y];
+    return m_tileBaseLocations((int)pos.x, (int)pos.y);
 #else
-    return m_tileBaseLocations[pos.x / 32][pos.y / 32];
+    return m_tileBaseLocations(pos.x / 32, pos.y / 32);
 #endif
 }
 
@@ -272,20 +275,16 @@ const BaseLocation * BaseLocationManager::getNaturalExpansion(int player) const
 	{
 		return nullptr;
 	}
-	const BaseLocation * naturalBase = nullptr;
-	int minDistance = std::numeric_limits<int>::max();
 
-	for (const auto & base : getBaseLocations())
+	// the natural is the closest connected base to the main
+	for (const auto & base : m_baseDistances.getBasesByDistance(homeBase))
 	{
-		int dist = homeBase->getGroundDistance(base->getCenterOfBase());
-
-		if (base->getBaseID() != homeBase->getBaseID() && minDistance > dist && base->getCenterOfBase().x != 0)
+		if (base->getCenterOfBase().x != 0)
 		{
-			minDistance = dist;
-			naturalBase = base;
+			return base;
 		}
 	}
-	return naturalBase;
+	return nullptr;
 }
 
 void BaseLocationManager::drawBaseLocations()
@@ -312,6 +311,11 @@ const std::vector<const BaseLocation *> & BaseLocationManager::getBaseLocations(
     return m_baseLocationPtrs;
 }
 
+const BaseDistanceTable & BaseLocationManager::getBaseDistances() const
+{
+    return m_baseDistances;
+}
+
 
 const std::vector<const BaseLocation *> & BaseLocationManager::getStartingBaseLocations() const
 {
@@ -332,13 +336,9 @@ const std::set<const BaseLocation *> & BaseLocationManager::getOccupiedBaseLocat
 CCTilePosition BaseLocationManager::getNextExpansion(int player) const
 {
     const BaseLocation * homeBase = getPlayerStartingBaseLocation(player);
-    const BaseLocation * closestBase = nullptr;
-    int minDistance = std::numeric_limits<int>::max();
 
-    CCPosition homeTile = homeBase->getPosition();
-    
-	
-    for (auto & base : getBaseLocations())
+    // the bases are already sorted by ground distance from our main, and unconnected ones are left out
+    for (auto & base : m_baseDistances.getBasesByDistance(homeBase))
     {
         // skip mineral only and starting locations 
 		if (base->isMineralOnly() || base->isStartLocation() || base->isOccupiedByPlayer(Players::Self) || base->isOccupiedByPlayer(Players::Enemy))
@@ -346,48 +346,19 @@ CCTilePosition BaseLocationManager::getNextExpansion(int player) const
             continue;
         }
 
-        // get the tile position of the base
-        auto tile = base->getDepotPosition();
-        
-
-        bool buildingInTheWay = false; 
-
-        if (buildingInTheWay)
-        {
-            continue;
-        }
-
-        // the base's distance from our main nexus
-        int distanceFromHome = homeBase->getGroundDistance(tile);
-
-        // if it is not connected, continue
-        if (distanceFromHome < 0)
-        {
-            continue;
-        }
-
-        if (!closestBase || distanceFromHome < minDistance)
-        {
-            closestBase = base;
-            minDistance = distanceFromHome;
-        }
+        return base->getDepotPosition();
     }
 
-    return closestBase ? closestBase->getDepotPosition() : CCTilePosition(0, 0);
+    return CCTilePosition(0, 0);
 }
 
 CCTilePosition BaseLocationManager::getSkippedExpansion(int player) const
 {
 	const BaseLocation * homeBase = getPlayerStartingBaseLocation(player);
-	const BaseLocation * closestBase = nullptr;
-	const BaseLocation * secondClosest = nullptr;
-
-	int minDistance = std::numeric_limits<int>::max();
-	int secondMinDistance = std::numeric_limits<int>::max();
+	bool skippedClosest = false;
 
-	CCPosition homeTile = homeBase->getPosition();
-
-	for (auto & base : getBaseLocations())
+	// the bases are already sorted by ground distance from our main, and unconnected ones are left out
+	for (auto & base : m_baseDistances.getBasesByDistance(homeBase))
 	{
 		// skip mineral only and starting locations 
 		if (base->isMineralOnly() || base->isStartLocation() || base->isOccupiedByPlayer(Players::Self) || base->isOccupiedByPlayer(Players::Enemy))
@@ -395,39 +366,15 @@ CCTilePosition BaseLocationManager::getSkippedExpansion(int player) const
 			continue;
 		}
 
-		// get the tile position of the base
-		auto tile = base->getDepotPosition();
-
-
-		bool buildingInTheWay = false; 
-
-
-		if (buildingInTheWay)
+		// the closest free base is the regular next expansion, we want the one after it
+		if (!skippedClosest)
 		{
+			skippedClosest = true;
 			continue;
 		}
 
-		// the base's distance from our main nexus
-		int distanceFromHome = homeBase->getGroundDistance(tile);
-
-		// if it is not connected, continue
-		if (distanceFromHome < 0)
-		{
-			continue;
-		}
-		
-
-		if (!closestBase || distanceFromHome < minDistance)
-		{
-
-			closestBase = base;
-			minDistance = distanceFromHome;
-		}
-		else if (!secondClosest || minDistance < secondMinDistance < distanceFromHome) {
-			secondClosest = base;
-			secondMinDistance = distanceFromHome;
-		}
+		return base->getDepotPosition();
 	}
 
-	return secondClosest ? secondClosest->getDepotPosition() : CCTilePosition(0, 0);
+	return CCTilePosition(0, 0);
 }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "BaseLocation.h"
+#include "Grid2D.h"
+#include "BaseDistanceTable.h"
 
 class CCBot;
 
@@ -13,7 +15,8 @@ class BaseLocationManager
     std::vector<const BaseLocation *>               m_startingBaseLocations;
     std::map<int, const BaseLocation *>             m_playerStartingBaseLocations;
     std::map<int, std::set<const BaseLocation *>>   m_occupiedBaseLocations;
-    std::vector<std::vector<BaseLocation *>>        m_tileBaseLocations;
+    Grid2D<BaseLocation *>                          m_tileBaseLocations;
+    BaseDistanceTable                               m_baseDistances;
 
     
 
@@ -26,6 +29,7 @@ public:
     void drawBaseLocations();
 
     const std::vector<const BaseLocation *> & getBaseLocations() const;
+    const BaseDistanceTable & getBaseDistances() const;
 
 	BaseLocation * getBaseLocation(const CCPosition & pos) const;
 	//BaseLocation * getBaseLocation(const sc2::Point2D & enemyLocation) const;
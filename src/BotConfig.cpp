@@ -49,6 +49,10 @@ BotConfig::BotConfig()
     WorkersPerRefinery                  = 3;
     BuildingSpacing                     = 1;
     PylonSpacing                        = 3;
+
+    DistanceMapCacheSize                = 50;
+    ProfilerOutputFile                  = "FrameProfile.csv";
+    StepBudgetMs                        = 30;
 }
 
 void BotConfig::readConfigFile()
@@ -116,6 +120,15 @@ void BotConfig::readConfigFile()
         JSONTools::ReadInt("WorkersPerRefinery", macro, WorkersPerRefinery);
     }
 
+    // Parse the Performance Options
+    if (j.count("Performance") && j["Performance"].is_object())
+    {
+        const json & performance = j["Performance"];
+        JSONTools::ReadInt("DistanceMapCacheSize", performance, DistanceMapCacheSize);
+        JSONTools::ReadString("ProfilerOutputFile", performance, ProfilerOutputFile);
+        JSONTools::ReadInt("StepBudgetMs", performance, StepBudgetMs);
+    }
+
     // Parse the Debug Options
     if (j.count("Debug") && j["Debug"].is_object())
     {
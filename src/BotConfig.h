@@ -57,6 +57,10 @@ public:
     int WorkersPerRefinery;
     int BuildingSpacing;
     int PylonSpacing;
+
+    int DistanceMapCacheSize;
+    std::string ProfilerOutputFile;
+    int StepBudgetMs;
  
     BotConfig();
 
@@ -2,6 +2,7 @@
 #include "BuildingManager.h"
 #include "CCBot.h"
 #include "Util.h"
+#include "UnitClass.h"
 
 BuildingManager::BuildingManager(CCBot & bot)
     : m_bot(bot)
@@ -16,6 +17,10 @@ BuildingManager::BuildingManager(CCBot & bot)
 void BuildingManager::onStart()
 {
     m_buildingPlacer.onStart();
+
+    // construction starting and finishing are reported by the game, so they are not polled in onFrame
+    m_bot.Events().subscribe(UnitEvents::Created, [this](const Unit & unit) { onBuildingStarted(unit); });
+    m_bot.Events().subscribe(UnitEvents::ConstructionComplete, [this](const Unit & unit) { onBuildingCompleted(unit); });
 }
 
 // gets called every frame from GameCommander
@@ -35,12 +40,10 @@ void BuildingManager::onFrame()
     validateWorkersAndBuildings();          // check to see if assigned workers have died en route or while constructing
     assignWorkersToUnassignedBuildings();   // assign workers to the unassigned buildings and label them 'planned'    
     constructAssignedBuildings();           // for each planned building, if the worker isn't constructing, send the command    
-    checkForStartedConstruction();          // check to see if any buildings have started construction and update data structures    
 	checkForDamagedBuildings();	
 	repairDamagedBuildings();
 	checkFinishedRepairs();
     checkForDeadTerranBuilders();           // if we are terran and a building is under construction without a worker, assign a new one    
-    checkForCompletedBuildings();           // check to see if any buildings have completed and update data structures
 
     drawBuildingInformation();
 }
@@ -87,6 +90,13 @@ void BuildingManager::validateWorkersAndBuildings()
 // STEP 2: ASSIGN WORKERS TO BUILDINGS WITHOUT THEM
 void BuildingManager::assignWorkersToUnassignedBuildings()
 {
+    // forget answers nobody picked up, the building they were for has been removed or placed some other way
+    const int frame = m_bot.GetCurrentFrame();
+    m_placementRequests.erase(std::remove_if(m_placementRequests.begin(), m_placementRequests.end(), [frame](const PlacementRequest & request)
+    {
+        return request.ready && frame - request.readyFrame > 24;
+    }), m_placementRequests.end());
+
     // for each building that doesn't have a builder, assign one
     for (Building & b : m_buildings)
     {
@@ -99,8 +109,13 @@ void BuildingManager::assignWorkersToUnassignedBuildings()
 
         if (m_debugMode) { printf("Assigning Worker To: %s", b.type.getName().c_str()); }
 
-        // grab a worker unit from WorkerManager which is closest to this final position
-        CCTilePosition testLocation = getBuildingLocation(b);
+        // the location search runs on the job scheduler, so the building waits until its answer arrives
+        CCTilePosition testLocation;
+        if (!getDeferredBuildingLocation(b, testLocation))
+        {
+            continue;
+        }
+
         if (!m_bot.Map().isValidTile(testLocation) || (testLocation.x == 0 && testLocation.y == 0))
         {
             continue;
@@ -124,9 +139,7 @@ void BuildingManager::assignWorkersToUnassignedBuildings()
 
         m_buildingPlacer.reserveTiles((int)b.finalPosition.x, (int)b.finalPosition.y, b.type.tileWidth(), b.type.tileHeight());
 		
-		if (b.type.getName() == "TERRAN_BARRACKS" ||
-			b.type.getName() == "TERRAN_FACTORY" ||
-			b.type.getName() == "TERRAN_STARPORT") {
+		if (b.type.isClass(UnitClass::AddonProducer)) {
 			m_buildingPlacer.reserveTiles((int)b.finalPosition.x +3, (int)b.finalPosition.y, 2, 2);
 		}
 
@@ -246,9 +259,7 @@ void BuildingManager::constructAssignedBuildings()
 
 										m_buildingPlacer.reserveTiles((int)b.finalPosition.x, (int)b.finalPosition.y, b.type.tileWidth(), b.type.tileHeight());
 
-										if (b.type.getName() == "TERRAN_BARRACKS" ||
-											b.type.getName() == "TERRAN_FACTORY" ||
-											b.type.getName() == "TERRAN_STARPORT") {
+										if (b.type.isClass(UnitClass::AddonProducer)) {
 											m_buildingPlacer.reserveTiles((int)b.finalPosition.x + 3, (int)b.finalPosition.y, 2, 2);
 										}
 
@@ -309,55 +320,51 @@ void BuildingManager::constructAssignedBuildings()
 }
 
 // STEP 4: UPDATE DATA STRUCTURES FOR BUILDINGS STARTING CONSTRUCTION
-void BuildingManager::checkForStartedConstruction()
+void BuildingManager::onBuildingStarted(const Unit & buildingStarted)
 {
-    // for each building unit which is being constructed
-    for (auto buildingStarted : m_bot.UnitInfo().getUnits(Players::Self))
+    // filter out units which aren't our buildings under construction
+    // a building can be created with no progress yet, so this checks for not completed rather than isBeingConstructed
+    if (buildingStarted.getPlayer() != Players::Self || !buildingStarted.getType().isBuilding() || buildingStarted.isCompleted())
     {
-        // filter out units which aren't buildings under construction
-        if (!buildingStarted.getType().isBuilding() || !buildingStarted.isBeingConstructed())
+        return;
+    }
+
+    // check all our building status objects to see if we have a match and if we do, update it
+    for (auto & b : m_buildings)
+    {
+        if (b.status != BuildingStatus::Assigned)
         {
             continue;
         }
 
-        // check all our building status objects to see if we have a match and if we do, update it
+        // check if the positions match
+        int dx = b.finalPosition.x - buildingStarted.getTilePosition().x;
+        int dy = b.finalPosition.y - buildingStarted.getTilePosition().y;
 
-        for (auto & b : m_buildings)
+        if (dx*dx + dy*dy < Util::TileToPosition(1.0f))
         {
-            if (b.status != BuildingStatus::Assigned)
+            if (b.buildingUnit.isValid())
             {
-                continue;
+                std::cout << "Building mis-match somehow\n";
             }
 
-            // check if the positions match
-            int dx = b.finalPosition.x - buildingStarted.getTilePosition().x;
-            int dy = b.finalPosition.y - buildingStarted.getTilePosition().y;
-
-            if (dx*dx + dy*dy < Util::TileToPosition(1.0f))
-            {
-                if (b.buildingUnit.isValid())
-                {
-                    std::cout << "Building mis-match somehow\n";
-                }
-
-                // the resources should now be spent, so unreserve them
-                m_reservedMinerals -= buildingStarted.getType().mineralPrice();
-                m_reservedGas      -= buildingStarted.getType().gasPrice();
-                
-                // flag it as started and set the buildingUnit
-                b.underConstruction = true;
-                b.buildingUnit = buildingStarted;
+            // the resources should now be spent, so unreserve them
+            m_reservedMinerals -= buildingStarted.getType().mineralPrice();
+            m_reservedGas      -= buildingStarted.getType().gasPrice();
+            
+            // flag it as started and set the buildingUnit
+            b.underConstruction = true;
+            b.buildingUnit = buildingStarted;
 
 
-                // put it in the under construction vector
-                b.status = BuildingStatus::UnderConstruction;
+            // put it in the under construction vector
+            b.status = BuildingStatus::UnderConstruction;
 
-                // free this space
-                m_buildingPlacer.freeTiles((int)b.finalPosition.x, (int)b.finalPosition.y, b.type.tileWidth(), b.type.tileHeight());
+            // free this space
+            m_buildingPlacer.freeTiles((int)b.finalPosition.x, (int)b.finalPosition.y, b.type.tileWidth(), b.type.tileHeight());
 
-                // only one building will match
-                break;
-            }
+            // only one building will match
+            break;
         }
     }
 }
@@ -392,7 +399,7 @@ void BuildingManager::checkForDamagedBuildings()
 			
 
 			if ((b.getHitPoints() < b.getUnitPtr()->health_max) ||
-				(m_bot.GetThreatLevel() == 3 && b.getType().getName() == "TERRAN_BUNKER"))
+				(m_bot.GetThreatLevel() == 3 && b.getType().is(sc2::UNIT_TYPEID::TERRAN_BUNKER)))
 			{
 
 				bool found = false;
@@ -428,127 +435,20 @@ void BuildingManager::repairDamagedBuildings()
 
 		int numberOfWorkersNeeded = 1;
 
-		switch (m_bot.GetThreatLevel()) {
-
-		case 0:
-			if (damagedB.buildingUnit.getType().getName() == "TERRAN_BUNKER") {
-				numberOfWorkersNeeded = 2;
-			}
-			else if (damagedB.buildingUnit.getType().getName() == "TERRAN_MISSILETURRET") {
-				numberOfWorkersNeeded = 2;
-			}
-			else if (damagedB.buildingUnit.getType().getName() == "TERRAN_PLANTERYFORTRESS" ||
-				damagedB.buildingUnit.getType().getName() == "TERRAN_ORBITALCOMMAND") {
-				numberOfWorkersNeeded = 2;
-			}
-			else if (damagedB.buildingUnit.getType().getName() == "TERRAN_SUPPLYDEPOT") {
-				numberOfWorkersNeeded = 1;
-			}
-			else {
-				if (!m_bot.isUnderAttack()) {
-					numberOfWorkersNeeded = 1;
-				}
-				else {
-					numberOfWorkersNeeded = 0;
-				}
-
-			}
-			break;
-		case 1:
-			if (damagedB.buildingUnit.getType().getName() == "TERRAN_BUNKER") {
-				numberOfWorkersNeeded = 3;
-			}
-			else if (damagedB.buildingUnit.getType().getName() == "TERRAN_MISSILETURRET") {
-				numberOfWorkersNeeded = 2;
-			}
-			else if (damagedB.buildingUnit.getType().getName() == "TERRAN_PLANTERYFORTRESS" ||
-				damagedB.buildingUnit.getType().getName() == "TERRAN_ORBITALCOMMAND") {
-				numberOfWorkersNeeded = 3;
-			}
-			else if (damagedB.buildingUnit.getType().getName() == "TERRAN_SUPPLYDEPOT") {
-				numberOfWorkersNeeded = 1;
-			}
-			else {
-
-				if (!m_bot.isUnderAttack()) {
-					numberOfWorkersNeeded = 1;
-				}
-				else {
-					numberOfWorkersNeeded = 0;
-				}
-			}
-			break;
-		case 2:
-			if (damagedB.buildingUnit.getType().getName() == "TERRAN_BUNKER") {
-				numberOfWorkersNeeded = 4;
-			}
-			else if (damagedB.buildingUnit.getType().getName() == "TERRAN_MISSILETURRET") {
-				numberOfWorkersNeeded = 3;
-			}
-			else if (damagedB.buildingUnit.getType().getName() == "TERRAN_PLANTERYFORTRESS" ||
-				damagedB.buildingUnit.getType().getName() == "TERRAN_ORBITALCOMMAND") {
-				numberOfWorkersNeeded = 4;
-			}
-			else if (damagedB.buildingUnit.getType().getName() == "TERRAN_SUPPLYDEPOT") {
-				numberOfWorkersNeeded = 2;
-			}
-			else {
-				if (!m_bot.isUnderAttack()) {
-					numberOfWorkersNeeded = 1;
-				}
-				else {
-					numberOfWorkersNeeded = 0;
-				}
-			}
-			break;
-		case 3:
-			if (damagedB.buildingUnit.getType().getName() == "TERRAN_BUNKER") {
-				numberOfWorkersNeeded = 5;
-			}
-			else if (damagedB.buildingUnit.getType().getName() == "TERRAN_MISSILETURRET") {
-				numberOfWorkersNeeded = 4;
-			}
-			else if (damagedB.buildingUnit.getType().getName() == "TERRAN_PLANTERYFORTRESS" ||
-				damagedB.buildingUnit.getType().getName() == "TERRAN_ORBITALCOMMAND") {
-				numberOfWorkersNeeded = 5;
-			}
-			else if (damagedB.buildingUnit.getType().getName() == "TERRAN_SUPPLYDEPOT") {
-				numberOfWorkersNeeded = 3;
-			}
-			else {
-
-				if (!m_bot.isUnderAttack()) {
-					numberOfWorkersNeeded = 2;
-				}
-				else {
-					numberOfWorkersNeeded = 0;
-				}
-			}
-			break;
-		default:
-			if (damagedB.buildingUnit.getType().getName() == "TERRAN_BUNKER") {
-				numberOfWorkersNeeded = 2;
-			}
-			else if (damagedB.buildingUnit.getType().getName() == "TERRAN_MISSILETURRET") {
-				numberOfWorkersNeeded = 2;
-			}
-			else if (damagedB.buildingUnit.getType().getName() == "TERRAN_PLANTERYFORTRESS") {
-				numberOfWorkersNeeded = 2;
-			}
-			else if (damagedB.buildingUnit.getType().getName() == "TERRAN_SUPPLYDEPOT") {
-				numberOfWorkersNeeded = 1;
-			}
-			else {
-
-				if (!m_bot.isUnderAttack()) {
-					numberOfWorkersNeeded = 1;
-				}
-				else {
-					numberOfWorkersNeeded = 0;
-				}
-			}
-			break;
+		// important buildings get a fixed number of workers that grows with the threat level,
+		// anything else gets one or two while we are not under attack
+		const int repairGroup = UnitClass::GetRepairGroup(damagedB.buildingUnit.getType().getAPIUnitType().ToType());
+		const int threatLevel = m_bot.GetThreatLevel();
+		const int repairLevel = (threatLevel >= 0 && threatLevel <= UnitClass::MaxRepairThreatLevel) ? threatLevel : 0;
 
+		if (repairGroup != UnitClass::RepairGroup::None) {
+			numberOfWorkersNeeded = UnitClass::RepairWorkers[repairLevel][repairGroup];
+		}
+		else if (!m_bot.isUnderAttack()) {
+			numberOfWorkersNeeded = (threatLevel == 3) ? 2 : 1;
+		}
+		else {
+			numberOfWorkersNeeded = 0;
 		}
 
 
@@ -600,45 +500,37 @@ void BuildingManager::repairDamagedBuildings()
 
 
 
-// STEP 6: CHECK FOR COMPLETED BUILDINGS
-void BuildingManager::checkForCompletedBuildings()
+// STEP 6: UPDATE DATA STRUCTURES FOR COMPLETED BUILDINGS
+void BuildingManager::onBuildingCompleted(const Unit & buildingUnit)
 {
     std::vector<Building> toRemove;
 
-    // for each of our buildings under construction
+    // find the building under construction that just completed
     for (auto & b : m_buildings)
     {
-        if (b.status != BuildingStatus::UnderConstruction)
+        if (b.status != BuildingStatus::UnderConstruction || !(b.buildingUnit == buildingUnit))
         {
             continue;
         }
 
-        // if the unit has completed
-        if (b.buildingUnit.isCompleted())
+        // if we are terran, give the worker back to worker manager
+        if (Util::IsTerran(m_bot.GetPlayerRace(Players::Self)))
         {
-            // if we are terran, give the worker back to worker manager
-            if (Util::IsTerran(m_bot.GetPlayerRace(Players::Self)))
-            {
-                m_bot.Workers().finishedWithWorker(b.builderUnit);
-
-				std::cout << "Building " << b.buildingUnit.getType().getName() << " id: " << b.buildingUnit.getID() << " has finished\n";
-
-				if (b.buildingUnit.getType().getName() == "TERRAN_SUPPLYDEPOT") {
-					b.buildingUnit.lowerDepot();
-				}
-            }
+            m_bot.Workers().finishedWithWorker(b.builderUnit);
 
-            // remove this unit from the under construction vector
-            toRemove.push_back(b);
+			std::cout << "Building " << b.buildingUnit.getType().getName() << " id: " << b.buildingUnit.getID() << " has finished\n";
 
+			//custom, if the finished building is a depot, lower it
+			if (b.buildingUnit.getType().is(sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOT)) {
+				b.buildingUnit.lowerDepot();
+			}
         }
 
-		//if it does not need any repairs
-		
+        // remove this unit from the under construction vector
+        toRemove.push_back(b);
+        break;
     }
 
-	//custom, if the finished building is a depot, lower it
-
     removeBuildings(toRemove);
 }
 
@@ -647,7 +539,7 @@ void BuildingManager::checkFinishedRepairs()
 	for (int i = 0; i < m_damagedBuildings.size(); i++) {
 		if (((m_damagedBuildings[i].buildingUnit.getHitPoints() == m_damagedBuildings[i].buildingUnit.getUnitPtr()->health_max) &&
 
-			!(m_damagedBuildings[i].buildingUnit.getType().getName() == "TERRAN_BUNKER" && m_bot.GetThreatLevel() == 3)) || 
+			!(m_damagedBuildings[i].buildingUnit.getType().is(sc2::UNIT_TYPEID::TERRAN_BUNKER) && m_bot.GetThreatLevel() == 3)) || 
 
 			!m_damagedBuildings[i].buildingUnit.isAlive()) {
 
@@ -679,7 +571,10 @@ void BuildingManager::prepositionWorkers(const UnitType & type, const CCTilePosi
 
 		//std::cout << "desired loc, x:" << testLocation.x << " y:" << testLocation.y << "\n";
 		//std::cout << builderUnit.getID() << " x:" << builderUnit.getPosition().x << " y:" << builderUnit.getPosition().y << "\n";
-		builderUnit.move(testLocation);
+		// the worker waits at the building site, so it should not walk through enemy fire getting there
+		if (builderUnit.isValid()) {
+			builderUnit.move(m_bot.SafePaths().getNextWaypoint(builderUnit.getPosition(), buildingPos));
+		}
 
 		/**
 		if (builderUnit.isValid()) {
@@ -900,6 +795,63 @@ std::vector<UnitType> BuildingManager::buildingsQueued() const
     return buildingsQueued;
 }
 
+// returns true and sets location once the scheduled search for this building has finished
+// the first call queues the search, which runs as a single job step
+bool BuildingManager::getDeferredBuildingLocation(const Building & b, CCTilePosition & location)
+{
+    for (size_t i(0); i < m_placementRequests.size(); ++i)
+    {
+        PlacementRequest & request = m_placementRequests[i];
+        if (!(request.type == b.type) || request.desiredPosition != b.desiredPosition)
+        {
+            continue;
+        }
+
+        if (!request.ready)
+        {
+            return false;
+        }
+
+        location = request.location;
+        m_placementRequests.erase(m_placementRequests.begin() + i);
+
+        // another building may have reserved these tiles while the answer was waiting, search again if so
+        if (!m_buildingPlacer.isFree(location.x, location.y, b.type.tileWidth(), b.type.tileHeight()))
+        {
+            break;
+        }
+
+        return true;
+    }
+
+    PlacementRequest request;
+    request.type            = b.type;
+    request.desiredPosition = b.desiredPosition;
+    request.ready           = false;
+    request.readyFrame      = 0;
+    request.location        = CCTilePosition(0, 0);
+
+    // the placement scan only expands its search as far as the tiles it checks, so there is no distance map to warm first
+    request.job = m_bot.Scheduler().schedule("Placement " + b.type.getName(), JobPriority::High, m_bot.GetCurrentFrame() + 8, [this, b]()
+    {
+        const CCTilePosition location = getBuildingLocation(b);
+        for (auto & request : m_placementRequests)
+        {
+            if (request.type == b.type && request.desiredPosition == b.desiredPosition && !request.ready)
+            {
+                request.ready       = true;
+                request.readyFrame  = m_bot.GetCurrentFrame();
+                request.location    = location;
+                break;
+            }
+        }
+        return true;
+    });
+
+    m_placementRequests.push_back(request);
+    return false;
+}
+
 CCTilePosition BuildingManager::getBuildingLocation(const Building & b)
 {
     size_t numPylons = m_bot.UnitInfo().getUnitTypeCount(Players::Self, Util::GetSupplyProvider(m_bot.GetPlayerRace(Players::Self), m_bot), true);
@@ -915,7 +867,7 @@ CCTilePosition BuildingManager::getBuildingLocation(const Building & b)
         return m_bot.Bases().getNextExpansion(Players::Self);
     }
 
-	if (b.type.getName() == "TERRAN_SUPPLYDEPOT") {
+	if (b.type.is(sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOT)) {
 
 		sc2::Point2D testPoint = m_bot.Map().getWallPositionDepot();
 		if (testPoint != sc2::Point2D(0, 0))
@@ -925,11 +877,7 @@ CCTilePosition BuildingManager::getBuildingLocation(const Building & b)
 		return m_buildingPlacer.getBuildLocationNear(b, 0);
 	}
 
-	if (b.type.getName() == "TERRAN_MISSILETURRET" ||
-		b.type.getName() == "TERRAN_BUNKER"  ||
-		b.type.getName() == "TERRAN_ENGINEERINGBAY" || 
-		b.type.getName() == "TERRAN_ARMORY" ||
-		b.type.getName() == "TERRAN_STARPORT") {
+	if (b.type.isClass(UnitClass::TightPlacement)) {
 		return m_buildingPlacer.getBuildLocationNear(b, 0);
 	}
 
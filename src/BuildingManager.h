@@ -2,16 +2,29 @@
 
 #include "Common.h"
 #include "BuildingPlacer.h"
+#include "JobScheduler.h"
 
 class CCBot;
 
 class BuildingManager
 {
+    // a building location search running on the job scheduler
+    struct PlacementRequest
+    {
+        UnitType                type;
+        CCTilePosition          desiredPosition;
+        JobScheduler::JobID     job;
+        bool                    ready;
+        int                     readyFrame;
+        CCTilePosition          location;
+    };
+
     CCBot &   m_bot;
 
     BuildingPlacer  m_buildingPlacer;
     std::vector<Building> m_buildings;
 	std::vector<Building> m_damagedBuildings;
+    std::vector<PlacementRequest> m_placementRequests;
 
     bool            m_debugMode;
     int             m_reservedMinerals;				// minerals reserved for planned buildings
@@ -23,16 +36,17 @@ class BuildingManager
     void            validateWorkersAndBuildings();		    // STEP 1
     void            assignWorkersToUnassignedBuildings();	// STEP 2
     void            constructAssignedBuildings();			// STEP 3
-    void            checkForStartedConstruction();			// STEP 4
+    void            onBuildingStarted(const Unit & buildingStarted);	// STEP 4, on UnitEvents::Created
     void            checkForDeadTerranBuilders();			// STEP 5
 	void			checkForDamagedBuildings();				// STEP 5.1 custom
 	void			repairDamagedBuildings();				// step 5.2 custom
-    void            checkForCompletedBuildings();			// STEP 6
+    void            onBuildingCompleted(const Unit & buildingUnit);	// STEP 6, on UnitEvents::ConstructionComplete
 	void			checkFinishedRepairs();					//STEP 6.1
 
 	bool			canBuild(const UnitType & type);		//custom, check reserves for building
 
     char            getBuildingWorkerCode(const Building & b) const;
+    bool            getDeferredBuildingLocation(const Building & b, CCTilePosition & location);
 
 
 public:
@@ -1,8 +1,10 @@
 #include "Common.h"
 #include "BuildingPlacer.h"
 #include "CCBot.h"
+#include "UnitClass.h"
 #include "Building.h"
 #include "Util.h"
+#include "Timer.hpp"
 
 BuildingPlacer::BuildingPlacer(CCBot & bot)
     : m_bot(bot)
@@ -12,7 +14,8 @@ BuildingPlacer::BuildingPlacer(CCBot & bot)
 
 void BuildingPlacer::onStart()
 {
-    m_reserveMap = std::vector< std::vector<bool> >(m_bot.Map().width(), std::vector<bool>(m_bot.Map().height(), false));
+    m_reserveMap.reset(m_bot.Map().width(), m_bot.Map().height(), false);
+    m_reservedSums.invalidate();
 }
 
 bool BuildingPlacer::isInResourceBox(int tileX, int tileY) const
@@ -23,28 +26,23 @@ bool BuildingPlacer::isInResourceBox(int tileX, int tileY) const
 // makes final checks to see if a building can be built at a certain location
 bool BuildingPlacer::canBuildHere(int bx, int by, const Building & b) const
 {
-    if (isInResourceBox(bx, by) && b.type.getName() != "TERRAN_MISSILETURRET")
+    if (isInResourceBox(bx, by) && !b.type.is(sc2::UNIT_TYPEID::TERRAN_MISSILETURRET))
     {
         return false;
     }
 
 	//edit: check if threat map is a condition
 	if (m_bot.getThreatTolerance() > 0) {
-		if (!m_bot.ThreatMap().canBuildHereWithTolerance(bx, by, b.type.tileHeight(), b.type.tileWidth(), m_bot.getThreatTolerance())) {
+		if (!m_bot.Influence().canBuildHereWithTolerance(bx, by, b.type.tileHeight(), b.type.tileWidth(), m_bot.getThreatTolerance())) {
 			return false;
 		}
 	}
 
     // check the reserve map
-    for (int x = bx; x < bx + b.type.tileWidth(); x++)
+    if (!m_bot.Map().isValidTile(bx, by) || !m_bot.Map().isValidTile(bx + b.type.tileWidth() - 1, by + b.type.tileHeight() - 1)
+        || reservedCount(bx, by, b.type.tileWidth(), b.type.tileHeight()) > 0)
     {
-        for (int y = by; y < by + b.type.tileHeight(); y++)
-        {
-            if (!m_bot.Map().isValidTile(x, y) || m_reserveMap[x][y])
-            {
-                return false;
-            }
-        }
+        return false;
     }
 
     // if it overlaps a base location return false
@@ -56,6 +54,23 @@ bool BuildingPlacer::canBuildHere(int bx, int by, const Building & b) const
     return true;
 }
 
+// returns true if none of the tiles in the rectangle are reserved
+bool BuildingPlacer::isFree(int x, int y, int width, int height) const
+{
+    return reservedCount(x, y, width, height) == 0;
+}
+
+// number of reserved tiles in the rectangle, tiles off the map count as free
+int BuildingPlacer::reservedCount(int x, int y, int width, int height) const
+{
+    if (m_reservedSums.isDirty())
+    {
+        m_reservedSums.build(m_reserveMap.width(), m_reserveMap.height(), [this](int tx, int ty) { return m_reserveMap(tx, ty) ? 1 : 0; });
+    }
+
+    return m_reservedSums.sum(x, y, width, height);
+}
+
 //returns true if we can build this type of unit here with the specified amount of space.
 bool BuildingPlacer::canBuildHereWithSpace(int bx, int by, const Building & b, int buildDist) const
 {
@@ -72,7 +87,8 @@ bool BuildingPlacer::canBuildHereWithSpace(int bx, int by, const Building & b, i
     int height = b.type.tileHeight();
 
 
-	if (b.type.getName() == "Barracks") {
+	// leave room for the addon, see BuildingManager::assignWorkersToUnassignedBuildings
+	if (b.type.isClass(UnitClass::AddonProducer)) {
 		width += 2;
 	}
 	
@@ -88,27 +104,30 @@ bool BuildingPlacer::canBuildHereWithSpace(int bx, int by, const Building & b, i
         return false;
     }
 
-    // if we can't build here, or space is reserved, or it's in the resource box, we can't build here
+    if (b.type.isRefinery())
+    {
+        return true;
+    }
+
+    // if space is reserved, unplaceable or under another building we can't build here,
+    // which the summed tables answer for the whole rectangle before any per tile placement check
+    if (reservedCount(startx, starty, endx - startx, endy - starty) > 0 || !m_bot.Map().isFootprintClear(startx, starty, endx - startx, endy - starty))
+    {
+        return false;
+    }
+
+    std::vector<CCTilePosition> tiles;
+    tiles.reserve((size_t)(endx - startx) * (endy - starty));
     for (int x = startx; x < endx; x++)
     {
         for (int y = starty; y < endy; y++)
         {
-            if (!b.type.isRefinery())
-            {
-				if (b.type.getName() == "TERRAN_MISSILETURRET") {
-					if (!buildable(b, x, y)) {
-						return false;
-					}
-				}
-                if (!buildable(b, x, y) || m_reserveMap[x][y])
-                {
-                    return false;
-                }
-            }
+            tiles.push_back(CCTilePosition(x, y));
         }
     }
 
-    return true;
+    // if we can't build here we can't build here
+    return m_bot.Map().canBuildTypeAtAll(tiles, b.type);
 }
 
 CCTilePosition BuildingPlacer::getBuildLocationNear(const Building & b, int buildDist) const
@@ -116,23 +135,13 @@ CCTilePosition BuildingPlacer::getBuildLocationNear(const Building & b, int buil
     Timer t;
     t.start();
 
-    // get the precomputed vector of tile positions which are sorted closes to this location
-    auto & closestToBuilding = m_bot.Map().getClosestTilesTo(b.desiredPosition);
-
-    double ms1 = t.getElapsedTimeInMilliSec();
-
-    // iterate through the list until we've found a suitable location
-    for (size_t i(0); i < closestToBuilding.size() && i < 1000; ++i)
+    // walk the tiles closest to this location until we've found a suitable one,
+    // the search only expands as far as the tiles we actually check
+    CCTilePosition pos;
+    if (m_bot.Map().findClosestTile(b.desiredPosition, 1000, [&](const CCTilePosition & tile) { return canBuildHereWithSpace(tile.x, tile.y, b, buildDist); }, pos))
     {
-        auto & pos = closestToBuilding[i];
-
-        if (canBuildHereWithSpace(pos.x, pos.y, b, buildDist))
-        {
-            double ms = t.getElapsedTimeInMilliSec();
-            //printf("Building Placer Took %d iterations, lasting %lf ms @ %lf iterations/ms, %lf setup ms\n", (int)i, ms, (i / ms), ms1);
-
-            return pos;
-        }
+        //printf("Building Placer took %lf ms\n", t.getElapsedTimeInMilliSec());
+        return pos;
     }
 
     double ms = t.getElapsedTimeInMilliSec();
@@ -178,27 +187,19 @@ bool BuildingPlacer::tileOverlapsBaseLocation(int x, int y, UnitType type) const
     return false;
 }
 
-bool BuildingPlacer::buildable(const Building & b, int x, int y) const
-{
-    if (!m_bot.Map().isValidTile(x, y) || !m_bot.Map().canBuildTypeAtPosition(x, y, b.type))
-    {
-        return false;
-    }
-
-    return true;
-}
-
 void BuildingPlacer::reserveTiles(int bx, int by, int width, int height)
 {
-    int rwidth = (int)m_reserveMap.size();
-    int rheight = (int)m_reserveMap[0].size();
-    for (int x = bx; x < bx + width && x < rwidth; x++)
+    int rwidth = m_reserveMap.width();
+    int rheight = m_reserveMap.height();
+    for (int y = by; y < by + height && y < rheight; y++)
     {
-        for (int y = by; y < by + height && y < rheight; y++)
+        for (int x = bx; x < bx + width && x < rwidth; x++)
         {
-            m_reserveMap[x][y] = true;
+            m_reserveMap.set(x, y, true);
         }
     }
+
+    m_reservedSums.invalidate();
 }
 
 void BuildingPlacer::drawReservedTiles()
@@ -208,14 +209,14 @@ void BuildingPlacer::drawReservedTiles()
         return;
     }
 
-    int rwidth = (int)m_reserveMap.size();
-    int rheight = (int)m_reserveMap[0].size();
+    int rwidth = m_reserveMap.width();
+    int rheight = m_reserveMap.height();
 
-    for (int x = 0; x < rwidth; ++x)
+    for (int y = 0; y < rheight; ++y)
     {
-        for (int y = 0; y < rheight; ++y)
+        for (int x = 0; x < rwidth; ++x)
         {
-            if (m_reserveMap[x][y] || isInResourceBox(x, y))
+            if (m_reserveMap(x, y) || isInResourceBox(x, y))
             {
                 m_bot.Map().drawTile(x, y, CCColor(255, 255, 0));
             }
@@ -225,16 +226,18 @@ void BuildingPlacer::drawReservedTiles()
 
 void BuildingPlacer::freeTiles(int bx, int by, int width, int height)
 {
-    int rwidth = (int)m_reserveMap.size();
-    int rheight = (int)m_reserveMap[0].size();
+    int rwidth = m_reserveMap.width();
+    int rheight = m_reserveMap.height();
 
-    for (int x = bx; x < bx + width && x < rwidth; x++)
+    for (int y = by; y < by + height && y < rheight; y++)
     {
-        for (int y = by; y < by + height && y < rheight; y++)
+        for (int x = bx; x < bx + width && x < rwidth; x++)
         {
-            m_reserveMap[x][y] = false;
+            m_reserveMap.set(x, y, false);
         }
     }
+
+    m_reservedSums.invalidate();
 }
 
 CCTilePosition BuildingPlacer::getRefineryPosition()
@@ -298,13 +301,11 @@ CCTilePosition BuildingPlacer::getRefineryPosition()
 
 bool BuildingPlacer::isReserved(int x, int y) const
 {
-    int rwidth = (int)m_reserveMap.size();
-    int rheight = (int)m_reserveMap[0].size();
-    if (x < 0 || y < 0 || x >= rwidth || y >= rheight)
+    if (!m_reserveMap.isValid(x, y))
     {
         return false;
     }
 
-    return m_reserveMap[x][y];
+    return m_reserveMap(x, y);
 }
 
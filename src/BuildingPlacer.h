@@ -2,6 +2,8 @@
 
 #include "Common.h"
 #include "BuildingData.h"
+#include "Grid2D.h"
+#include "SummedAreaTable.h"
 
 class CCBot;
 class BaseLocation;
@@ -10,11 +12,12 @@ class BuildingPlacer
 {
     CCBot & m_bot;
 
-    std::vector< std::vector<bool> > m_reserveMap;
+    Grid2D<bool> m_reserveMap;
+    mutable SummedAreaTable m_reservedSums;     // counts reserved tiles, rebuilt on the first check after a reserve or free
 
     // queries for various BuildingPlacer data
-    bool buildable(const Building & b, int x, int y) const;
     bool isReserved(int x, int y) const;
+    int  reservedCount(int x, int y, int width, int height) const;
     bool isInResourceBox(int x, int y) const;
     bool tileOverlapsBaseLocation(int x, int y, UnitType type) const;
 
@@ -28,6 +31,7 @@ public:
     // determines whether we can build at a given location
     bool canBuildHere(int bx, int by, const Building & b) const;
     bool canBuildHereWithSpace(int bx, int by, const Building & b, int buildDist) const;
+    bool isFree(int x, int y, int width, int height) const;
 
     // returns a build location near a building's desired location
     CCTilePosition getBuildLocationNear(const Building & b, int buildDist) const;
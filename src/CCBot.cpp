@@ -9,13 +9,18 @@ CCBot::CCBot()
     , m_gameCommander(*this)
     , m_strategy(*this)
     , m_techTree(*this)
-	, m_threatMap(*this)
+    , m_influence(*this)
+    , m_safePaths(*this)
+    , m_scheduler(*this)
 {
-    
+    Unit::Bind(*this, m_snapshot);
 }
 
 void CCBot::OnGameStart() 
 {
+    // index the game data names first, everything after this resolves names through it
+    m_names.build(*this);
+
     m_config.readConfigFile();
 
     // add all the possible start locations on the map
@@ -55,21 +60,35 @@ void CCBot::OnGameStart()
 	m_workers.onStart();
 
     m_gameCommander.onStart();
-	m_threatMap.onStart();
+    m_influence.onStart();
+    m_safePaths.onStart();
 	
 }
 
 void CCBot::OnStep()
 {
+	m_profiler.beginFrame();
+	m_scheduler.beginFrame();
+
+	{ ProfileScope scope(m_profiler, "setUnits");          setUnits(); }
+	{ ProfileScope scope(m_profiler, "UnitEvents");        m_events.dispatch(); }
+	{ ProfileScope scope(m_profiler, "MapTools");          m_map.onFrame(); }
+	{ ProfileScope scope(m_profiler, "UnitInfoManager");   m_unitInfo.onFrame(); }
+	{ ProfileScope scope(m_profiler, "BaseLocations");     m_bases.onFrame(); }
+	{ ProfileScope scope(m_profiler, "WorkerManager");     m_workers.onFrame(); }
+	{ ProfileScope scope(m_profiler, "StrategyManager");   m_strategy.onFrame(); }
+	{ ProfileScope scope(m_profiler, "GameCommander");     m_gameCommander.onFrame(); }
+
+	// deferred work only gets whatever is left of the step budget
+	{ ProfileScope scope(m_profiler, "JobScheduler");      m_scheduler.run(); }
 
-	setUnits();
-	m_map.onFrame();
-	m_unitInfo.onFrame();
-	m_bases.onFrame();
-	m_workers.onFrame();
-	m_strategy.onFrame();
-	m_gameCommander.onFrame();
+	m_profiler.endFrame();
 
+	if (m_config.DrawModuleTimers)
+	{
+		m_profiler.draw(*this);
+		m_scheduler.draw();
+	}
 
 	#ifdef SC2API
 			Debug()->SendDebug();
@@ -77,21 +96,55 @@ void CCBot::OnStep()
  
 }
 
+void CCBot::OnGameEnd()
+{
+	m_profiler.writeCSV(m_config.ProfilerOutputFile);
+}
+
+#ifdef SC2API
+// the API calls these while it processes the new observation, they are queued and dispatched in OnStep
+void CCBot::OnUnitCreated(const sc2::Unit * unit)
+{
+    m_events.post(UnitEvents::Created, Unit(unit, *this));
+}
+
+void CCBot::OnUnitDestroyed(const sc2::Unit * unit)
+{
+    m_events.post(UnitEvents::Destroyed, Unit(unit, *this));
+}
+
+void CCBot::OnBuildingConstructionComplete(const sc2::Unit * unit)
+{
+    m_events.post(UnitEvents::ConstructionComplete, Unit(unit, *this));
+}
+
+void CCBot::OnUnitIdle(const sc2::Unit * unit)
+{
+    m_events.post(UnitEvents::Idle, Unit(unit, *this));
+}
+
+void CCBot::OnUnitEnterVision(const sc2::Unit * unit)
+{
+    m_events.post(UnitEvents::EnterVision, Unit(unit, *this));
+}
+#endif
+
 void CCBot::setUnits()
 {
-    m_allUnits.clear();
 #ifdef SC2API
     Control()->GetObservation();
-    for (auto & unit : Observation()->GetUnits())
-    {
-        m_allUnits.push_back(Unit(unit, *this));    
-    }
-#else
-    for (auto & unit : BWAPI::Broodwar->getAllUnits())
+#endif
+
+    // one pass over the API's units fills the snapshot, the unit list is just a handle per snapshot slot
+    m_snapshot.build(*this);
+
+    m_allUnits.clear();
+    for (size_t slot(0); slot < m_snapshot.size(); ++slot)
     {
-        m_allUnits.push_back(Unit(unit, *this));
+        m_allUnits.push_back(Unit(m_snapshot.getID((uint32_t)slot), (uint32_t)slot));
     }
-#endif
+
+    m_spatial.build(m_snapshot, m_allUnits);
 }
 
 CCRace CCBot::GetPlayerRace(int player) const
@@ -130,9 +183,44 @@ const MapTools & CCBot::Map() const
     return m_map;
 }
 
-ThreatMap & CCBot::ThreatMap() 
+InfluenceMap & CCBot::Influence()
+{
+    return m_influence;
+}
+
+SafePathCache & CCBot::SafePaths()
 {
-	return m_threatMap;
+    return m_safePaths;
+}
+
+FrameProfiler & CCBot::Profiler()
+{
+    return m_profiler;
+}
+
+JobScheduler & CCBot::Scheduler()
+{
+    return m_scheduler;
+}
+
+const NameRegistry & CCBot::Names() const
+{
+    return m_names;
+}
+
+const SpatialIndex & CCBot::Spatial() const
+{
+    return m_spatial;
+}
+
+const UnitSnapshot & CCBot::Snapshot() const
+{
+    return m_snapshot;
+}
+
+UnitEventBus & CCBot::Events()
+{
+    return m_events;
 }
 
 const StrategyManager & CCBot::Strategy() const
@@ -280,6 +368,12 @@ int CCBot::GetGas() const
 
 Unit CCBot::GetUnit(const CCUnitID & tag) const
 {
+    const uint32_t slot = m_snapshot.getSlot(tag);
+    if (slot != UnitSnapshot::InvalidSlot)
+    {
+        return Unit(tag, slot);
+    }
+
 #ifdef SC2API
     return Unit(Observation()->GetUnit(tag), *(CCBot *)this);
 #else
@@ -13,7 +13,14 @@
 #include "TechTree.h"
 #include "MetaType.h"
 #include "Unit.h"
-#include "ThreatMap.h"
+#include "InfluenceMap.h"
+#include "SafePathCache.h"
+#include "FrameProfiler.h"
+#include "JobScheduler.h"
+#include "NameRegistry.h"
+#include "SpatialIndex.h"
+#include "UnitSnapshot.h"
+#include "UnitEvents.h"
 
 #ifdef SC2API
 class CCBot : public sc2::Agent 
@@ -29,7 +36,14 @@ class CCBot
     BotConfig               m_config;
     TechTree                m_techTree;
     GameCommander           m_gameCommander;
-	ThreatMap				m_threatMap;
+    InfluenceMap            m_influence;
+    SafePathCache           m_safePaths;
+    FrameProfiler           m_profiler;
+    JobScheduler            m_scheduler;
+    NameRegistry            m_names;
+    SpatialIndex            m_spatial;
+    UnitSnapshot            m_snapshot;
+    UnitEventBus            m_events;
 
 
     std::vector<Unit>       m_allUnits;
@@ -58,16 +72,30 @@ public:
 #ifdef SC2API
     void OnGameStart() override;
     void OnStep() override;
+    void OnGameEnd() override;
+    void OnUnitCreated(const sc2::Unit * unit) override;
+    void OnUnitDestroyed(const sc2::Unit * unit) override;
+    void OnBuildingConstructionComplete(const sc2::Unit * unit) override;
+    void OnUnitIdle(const sc2::Unit * unit) override;
+    void OnUnitEnterVision(const sc2::Unit * unit) override;
 #else
     void OnGameStart();
     void OnStep();
+    void OnGameEnd();
 #endif
 
           BotConfig & Config();
           WorkerManager & Workers();
     const BaseLocationManager & Bases() const;
     const MapTools & Map() const;
-	      ThreatMap & ThreatMap();
+          InfluenceMap & Influence();
+          SafePathCache & SafePaths();
+          FrameProfiler & Profiler();
+          JobScheduler & Scheduler();
+    const NameRegistry & Names() const;
+    const SpatialIndex & Spatial() const;
+    const UnitSnapshot & Snapshot() const;
+          UnitEventBus & Events();
     const UnitInfoManager & UnitInfo() const;
     const StrategyManager & Strategy() const;
     const TypeData & Data(const UnitType & type) const;
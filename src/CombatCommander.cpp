@@ -38,6 +38,11 @@ bool CombatCommander::isSquadUpdateFrame()
     return true;
 }
 
+void CombatCommander::onUnitDestroy(const Unit & unit)
+{
+    m_squadData.onUnitDestroy(unit);
+}
+
 void CombatCommander::onFrame(const std::vector<Unit> & combatUnits)
 {
     if (!m_attackStarted)
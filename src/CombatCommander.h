@@ -38,5 +38,6 @@ public:
     void onFrame(const std::vector<Unit> & combatUnits);
 
     void drawSquadInformation();
+    void onUnitDestroy(const Unit & unit);
 };
 
@@ -8,6 +8,7 @@ Condition::Condition()
     , m_type    (ConditionTypes::Invalid)
     , m_op      (ConditionOperators::Invalid)
     , m_player  (0)
+    , m_unitTypeResolved(false)
 {
 
 }
@@ -81,7 +82,13 @@ int Condition::intEval() const
     }
     else if (m_type == ConditionTypes::UnaryUnitType)
     {
-        return (int)m_bot->UnitInfo().getUnitTypeCount(m_player, UnitType::GetUnitTypeFromName(m_strValue, *m_bot));
+        if (!m_unitTypeResolved)
+        {
+            m_unitType = UnitType::GetUnitTypeFromName(m_strValue, *m_bot);
+            m_unitTypeResolved = true;
+        }
+
+        return (int)m_bot->UnitInfo().getUnitTypeCount(m_player, m_unitType);
     }
     else if (m_type == ConditionTypes::UnaryString)
     {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Common.h"
+#include "UnitType.h"
 
 class CCBot;
 
@@ -23,6 +24,8 @@ class Condition
     Condition * m_rhs;
     int         m_op;
     std::string m_strValue;
+    mutable UnitType m_unitType;        // m_strValue resolved to a unit type the first time it is evaluated
+    mutable bool     m_unitTypeResolved;
     int         m_intValue;
     json        m_json;
         
@@ -2,19 +2,21 @@
 #include "CCBot.h"
 #include "Util.h"
 
-const size_t LegalActions = 4;
-const int actionX[LegalActions] = {1, -1, 0, 0};
-const int actionY[LegalActions] = {0, 0, 1, -1};
+const uint16_t DistanceMap::UnreachableDistance;
 
 DistanceMap::DistanceMap() 
+    : m_width(0)
+    , m_height(0)
+    , m_sortedTilesComputed(false)
 {
     
 }
 
 int DistanceMap::getDistance(int tileX, int tileY) const
 { 
-    BOT_ASSERT(tileX < m_width && tileY < m_height, "Index out of range: X = %d, Y = %d", tileX, tileY);
-    return m_dist[tileX][tileY]; 
+    BOT_ASSERT(tileX >= 0 && tileY >= 0 && tileX < m_width && tileY < m_height, "Index out of range: X = %d, Y = %d", tileX, tileY);
+    uint16_t dist = m_dist(tileX, tileY);
+    return dist == UnreachableDistance ? -1 : dist;
 }
 
 int DistanceMap::getDistance(const CCTilePosition & pos) const
@@ -33,53 +35,88 @@ int DistanceMap::getDistance(const CCPosition & pos) const
 
 const std::vector<CCTilePosition> & DistanceMap::getSortedTiles() const
 {
+    if (!m_sortedTilesComputed)
+    {
+        computeSortedTiles();
+    }
+
     return m_sortedTiles;
 }
 
-// Computes m_dist[x][y] = ground distance from (startX, startY) to (x,y)
-// Uses BFS, since the map is quite large and DFS may cause a stack overflow
-void DistanceMap::computeDistanceMap(CCBot & m_bot, const CCTilePosition & startTile)
+// orders every reachable tile by its distance with a counting sort over the distance values
+void DistanceMap::computeSortedTiles() const
 {
-    m_startTile = startTile;
-    m_width = m_bot.Map().width();
-    m_height = m_bot.Map().height();
-    m_dist = std::vector<std::vector<int>>(m_width, std::vector<int>(m_height, -1));
-    m_sortedTiles.reserve(m_width * m_height);
-
-    // the fringe for the BFS we will perform to calculate distances
-    std::vector<CCTilePosition> fringe;
-    fringe.reserve(m_width * m_height);
-    fringe.push_back(startTile);
-    m_sortedTiles.push_back(startTile);
+    int maxDist = 0;
+    for (size_t i(0); i < m_dist.size(); ++i)
+    {
+        if (m_dist.data()[i] != UnreachableDistance)
+        {
+            maxDist = std::max(maxDist, (int)m_dist.data()[i]);
+        }
+    }
 
-    m_dist[(int)startTile.x][(int)startTile.y] = 0;
+    // bucketStart[d] is the index of the first tile with distance d in the sorted order
+    std::vector<size_t> bucketStart(maxDist + 2, 0);
+    for (size_t i(0); i < m_dist.size(); ++i)
+    {
+        if (m_dist.data()[i] != UnreachableDistance)
+        {
+            bucketStart[m_dist.data()[i] + 1]++;
+        }
+    }
 
-    for (size_t fringeIndex=0; fringeIndex<fringe.size(); ++fringeIndex)
+    for (int d(1); d <= maxDist + 1; ++d)
     {
-        auto & tile = fringe[fringeIndex];
+        bucketStart[d] += bucketStart[d - 1];
+    }
 
-        // check every possible child of this tile
-        for (size_t a=0; a<LegalActions; ++a)
+    m_sortedTiles.resize(bucketStart[maxDist + 1]);
+    for (int y(0); y < m_height; ++y)
+    {
+        for (int x(0); x < m_width; ++x)
         {
-            CCTilePosition nextTile(tile.x + actionX[a], tile.y + actionY[a]);
-
-            // if the new tile is inside the map bounds, is walkable, and has not been visited yet, set the distance of its parent + 1
-            if (m_bot.Map().isWalkable(nextTile) && getDistance(nextTile) == -1)
+            uint16_t dist = m_dist(x, y);
+            if (dist != UnreachableDistance)
             {
-                m_dist[(int)nextTile.x][(int)nextTile.y] = m_dist[(int)tile.x][(int)tile.y] + 1;
-                fringe.push_back(nextTile);
-                m_sortedTiles.push_back(nextTile);
+                m_sortedTiles[bucketStart[dist]++] = CCTilePosition(x, y);
             }
         }
     }
+
+    m_sortedTilesComputed = true;
+}
+
+// Computes m_dist(x, y) = ground distance from (startX, startY) to (x,y)
+// Uses the BFS kernel on the map's padded walkability mask, since the map is quite large and DFS may cause a stack overflow
+void DistanceMap::computeDistanceMap(CCBot & m_bot, const CCTilePosition & startTile)
+{
+    m_startTile = startTile;
+    m_width = m_bot.Map().width();
+    m_height = m_bot.Map().height();
+
+    // reuse the buffers left over from a previous computation, the cache recycles DistanceMaps
+    m_dist.reset(m_width, m_height, UnreachableDistance);
+    m_sortedTiles.clear();
+    m_sortedTilesComputed = false;
+
+    if (!m_dist.isValid(startTile.x, startTile.y))
+    {
+        return;
+    }
+
+    m_bot.Map().getWalkabilityMask().breadthFirstSearch(startTile.x, startTile.y, [this](int x, int y, int distance)
+    {
+        m_dist(x, y) = (uint16_t)distance;
+    });
 }
 
 void DistanceMap::draw(CCBot & bot) const
 {
-    const int tilesToDraw = 200;
-    for (size_t i(0); i < tilesToDraw; ++i)
+    const size_t tilesToDraw = 200;
+    const std::vector<CCTilePosition> & sortedTiles = getSortedTiles();
+    for (size_t i(0); i < tilesToDraw && i < sortedTiles.size(); ++i)
     {
-        auto & tile = m_sortedTiles[i];
+        auto & tile = sortedTiles[i];
         int dist = getDistance(tile);
 
         CCPosition textPos(tile.x + Util::TileToPosition(0.5), tile.y + Util::TileToPosition(0.5));
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "Common.h"
+#include "Grid2D.h"
 #include <map>
+#include <cstdint>
 
 class CCBot;
 
@@ -12,12 +14,18 @@ class DistanceMap
     int m_height;
     CCTilePosition m_startTile;
 
-    // 2D matrix storing distances from the start tile
-    std::vector<std::vector<int>> m_dist;
+    // distances from the start tile stored as 16 bit values, unreachable tiles hold UnreachableDistance
+    Grid2D<uint16_t> m_dist;
 
-    std::vector<CCTilePosition> m_sortedTiles;
+    // tiles ordered by distance, only built the first time someone asks for it
+    mutable std::vector<CCTilePosition> m_sortedTiles;
+    mutable bool m_sortedTilesComputed;
+
+    void computeSortedTiles() const;
     
 public:
+
+    static const uint16_t UnreachableDistance = 0xFFFF;
     
     DistanceMap();
     void computeDistanceMap(CCBot & m_bot, const CCTilePosition & startTile);
@@ -31,4 +39,4 @@ public:
     const CCTilePosition & getStartTile() const;
 
     void draw(CCBot & bot) const;
-};
\ No newline at end of file
+};
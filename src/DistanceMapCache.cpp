@@ -0,0 +1,142 @@
+#include "DistanceMapCache.h"
+#include "CCBot.h"
+
+DistanceMapCache::DistanceMapCache()
+    : m_capacity (50)
+    , m_hits     (0)
+    , m_misses   (0)
+    , m_evictions(0)
+{
+
+}
+
+void DistanceMapCache::setCapacity(size_t capacity)
+{
+    // we always need room for at least the map that was just requested
+    m_capacity = std::max(capacity, (size_t)1);
+
+    while (m_lru.size() > m_capacity)
+    {
+        evictLeastRecentlyUsed();
+    }
+}
+
+void DistanceMapCache::clear()
+{
+    m_entries.clear();
+    m_lru.clear();
+    m_freeSlots.clear();
+
+    // keep the slots themselves around so their buffers get reused
+    for (size_t i(0); i < m_slots.size(); ++i)
+    {
+        m_freeSlots.push_back(i);
+    }
+}
+
+size_t DistanceMapCache::acquireSlot()
+{
+    if (!m_freeSlots.empty())
+    {
+        size_t slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+        return slot;
+    }
+
+    m_slots.emplace_back();
+    return m_slots.size() - 1;
+}
+
+void DistanceMapCache::evictLeastRecentlyUsed()
+{
+    BOT_ASSERT(!m_lru.empty(), "Nothing to evict from the distance map cache");
+
+    auto it = m_entries.find(m_lru.back());
+    m_freeSlots.push_back(it->second.slot);
+    m_entries.erase(it);
+    m_lru.pop_back();
+    m_evictions++;
+}
+
+const DistanceMap & DistanceMapCache::get(CCBot & bot, const CCTilePosition & tile)
+{
+    Key key(tile.x, tile.y);
+
+    auto it = m_entries.find(key);
+    if (it != m_entries.end())
+    {
+        m_hits++;
+
+        // move the entry to the front of the recently used list
+        if (!it->second.pinned)
+        {
+            m_lru.splice(m_lru.begin(), m_lru, it->second.lruPosition);
+        }
+
+        return m_slots[it->second.slot];
+    }
+
+    m_misses++;
+
+    if (m_lru.size() >= m_capacity)
+    {
+        evictLeastRecentlyUsed();
+    }
+
+    size_t slot = acquireSlot();
+    m_slots[slot].computeDistanceMap(bot, tile);
+
+    m_lru.push_front(key);
+    m_entries[key] = { slot, false, m_lru.begin() };
+
+    return m_slots[slot];
+}
+
+const DistanceMap & DistanceMapCache::pin(CCBot & bot, const CCTilePosition & tile)
+{
+    const DistanceMap & distanceMap = get(bot, tile);
+
+    Entry & entry = m_entries[Key(tile.x, tile.y)];
+    if (!entry.pinned)
+    {
+        m_lru.erase(entry.lruPosition);
+        entry.pinned = true;
+    }
+
+    return distanceMap;
+}
+
+bool DistanceMapCache::contains(const CCTilePosition & tile) const
+{
+    return m_entries.find(Key(tile.x, tile.y)) != m_entries.end();
+}
+
+size_t DistanceMapCache::size() const
+{
+    return m_entries.size();
+}
+
+size_t DistanceMapCache::capacity() const
+{
+    return m_capacity;
+}
+
+size_t DistanceMapCache::pinnedCount() const
+{
+    return m_entries.size() - m_lru.size();
+}
+
+size_t DistanceMapCache::hits() const
+{
+    return m_hits;
+}
+
+size_t DistanceMapCache::misses() const
+{
+    return m_misses;
+}
+
+size_t DistanceMapCache::evictions() const
+{
+    return m_evictions;
+}
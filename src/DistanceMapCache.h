@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Common.h"
+#include "DistanceMap.h"
+#include <map>
+#include <list>
+#include <deque>
+
+class CCBot;
+
+// LRU cache of DistanceMaps keyed by their start tile
+// the maps live in a shared arena of slots which are recycled when an entry is evicted,
+// so a steady-state cache never reallocates its distance buffers
+// pinned entries (start locations, base centers) never count against the capacity and are never evicted
+class DistanceMapCache
+{
+    typedef std::pair<int, int> Key;
+
+    struct Entry
+    {
+        size_t                      slot;
+        bool                        pinned;
+        std::list<Key>::iterator    lruPosition;
+    };
+
+    size_t                  m_capacity;
+    std::deque<DistanceMap> m_slots;        // the arena, a deque so references to slots stay valid as it grows
+    std::vector<size_t>     m_freeSlots;
+    std::map<Key, Entry>    m_entries;
+    std::list<Key>          m_lru;          // unpinned keys, most recently used at the front
+
+    size_t                  m_hits;
+    size_t                  m_misses;
+    size_t                  m_evictions;
+
+    size_t  acquireSlot();
+    void    evictLeastRecentlyUsed();
+
+public:
+
+    DistanceMapCache();
+
+    void    setCapacity(size_t capacity);
+    void    clear();
+
+    const   DistanceMap & get(CCBot & bot, const CCTilePosition & tile);
+    const   DistanceMap & pin(CCBot & bot, const CCTilePosition & tile);
+    bool    contains(const CCTilePosition & tile) const;
+
+    size_t  size() const;
+    size_t  capacity() const;
+    size_t  pinnedCount() const;
+    size_t  hits() const;
+    size_t  misses() const;
+    size_t  evictions() const;
+};
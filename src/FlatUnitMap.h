@@ -0,0 +1,284 @@
+#pragma once
+
+#include "Common.h"
+#include "Unit.h"
+#include <algorithm>
+#include <iterator>
+
+// ids are mixed before use, sc2 tags only differ in a few low bits and would all land in the same buckets otherwise
+inline size_t HashUnitID(const CCUnitID & id)
+{
+    uint64_t h = (uint64_t)id;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return (size_t)h;
+}
+
+inline CCUnitID GetUnitKeyID(const CCUnitID & id)   { return id; }
+inline CCUnitID GetUnitKeyID(const Unit & unit)     { return unit.isValid() ? unit.getID() : Unit::InvalidID; }
+
+// Open addressing hash map keyed by a Unit or a CCUnitID, a drop in for the std::map<Unit, T> the managers used
+// entries live in one flat array and are found by linear probing from the hash of the unit id,
+// so a lookup is a hash and usually a single cache line instead of a walk down a tree of separately allocated nodes
+// erased entries leave a tombstone until the next rehash, so erasing while iterating is safe
+// iteration order is the order of the hash table, not the order of the ids
+template <class Key, class Value>
+class FlatUnitMap
+{
+public:
+
+    typedef std::pair<Key, Value> value_type;
+
+private:
+
+    enum : uint8_t { Empty = 0, Full = 1, Erased = 2 };
+
+    std::vector<uint8_t>    m_states;
+    std::vector<value_type> m_entries;
+    size_t                  m_size;
+    size_t                  m_used;     // full and erased slots, both lengthen probe chains
+
+    static const size_t npos = (size_t)-1;
+
+    size_t mask() const
+    {
+        return m_states.size() - 1;
+    }
+
+    size_t findIndex(const Key & key) const
+    {
+        return findIndexByID(GetUnitKeyID(key));
+    }
+
+    size_t findIndexByID(const CCUnitID & id) const
+    {
+        if (m_size == 0)
+        {
+            return npos;
+        }
+
+        for (size_t i = HashUnitID(id) & mask(); m_states[i] != Empty; i = (i + 1) & mask())
+        {
+            if (m_states[i] == Full && GetUnitKeyID(m_entries[i].first) == id)
+            {
+                return i;
+            }
+        }
+
+        return npos;
+    }
+
+    // slot count is a power of two kept at most three quarters used
+    void rehash(size_t minSize)
+    {
+        size_t capacity = 16;
+        while (capacity * 3 < minSize * 4)
+        {
+            capacity *= 2;
+        }
+
+        std::vector<uint8_t> states(capacity, Empty);
+        std::vector<value_type> entries(capacity);
+        for (size_t i(0); i < m_states.size(); ++i)
+        {
+            if (m_states[i] != Full)
+            {
+                continue;
+            }
+
+            size_t j = HashUnitID(GetUnitKeyID(m_entries[i].first)) & (capacity - 1);
+            while (states[j] != Empty)
+            {
+                j = (j + 1) & (capacity - 1);
+            }
+
+            states[j] = Full;
+            entries[j] = std::move(m_entries[i]);
+        }
+
+        m_states.swap(states);
+        m_entries.swap(entries);
+        m_used = m_size;
+    }
+
+    template <class Map, class Entry>
+    class Iterator
+    {
+        Map *   m_map;
+        size_t  m_index;
+
+        friend class FlatUnitMap;
+
+        void skipToFull()
+        {
+            while (m_index < m_map->m_states.size() && m_map->m_states[m_index] != Full)
+            {
+                ++m_index;
+            }
+        }
+
+    public:
+
+        typedef std::forward_iterator_tag   iterator_category;
+        typedef Entry                       value_type;
+        typedef std::ptrdiff_t              difference_type;
+        typedef Entry *                     pointer;
+        typedef Entry &                     reference;
+
+        Iterator(Map * map, size_t index) : m_map(map), m_index(index) { skipToFull(); }
+
+        // lets an iterator convert to a const_iterator
+        template <class OtherMap, class OtherEntry>
+        Iterator(const Iterator<OtherMap, OtherEntry> & other) : m_map(other.m_map), m_index(other.m_index) { }
+
+        Entry & operator *  () const { return m_map->m_entries[m_index]; }
+        Entry * operator -> () const { return &m_map->m_entries[m_index]; }
+
+        Iterator & operator ++ ()    { ++m_index; skipToFull(); return *this; }
+        Iterator   operator ++ (int) { Iterator it(*this); ++(*this); return it; }
+
+        bool operator == (const Iterator & rhs) const { return m_index == rhs.m_index; }
+        bool operator != (const Iterator & rhs) const { return m_index != rhs.m_index; }
+
+        template <class OtherMap, class OtherEntry> friend class Iterator;
+    };
+
+public:
+
+    typedef Iterator<FlatUnitMap, value_type>               iterator;
+    typedef Iterator<const FlatUnitMap, const value_type>   const_iterator;
+
+    FlatUnitMap()
+        : m_size(0)
+        , m_used(0)
+    {
+
+    }
+
+    iterator        begin()         { return iterator(this, 0); }
+    iterator        end()           { return iterator(this, m_states.size()); }
+    const_iterator  begin() const   { return const_iterator(this, 0); }
+    const_iterator  end() const     { return const_iterator(this, m_states.size()); }
+
+    size_t  size() const    { return m_size; }
+    bool    empty() const   { return m_size == 0; }
+
+    iterator find(const Key & key)
+    {
+        const size_t i = findIndex(key);
+        return i == npos ? end() : iterator(this, i);
+    }
+
+    const_iterator find(const Key & key) const
+    {
+        const size_t i = findIndex(key);
+        return i == npos ? end() : const_iterator(this, i);
+    }
+
+    // lookup by id alone, for maps keyed by Unit that only have an id to hand
+    iterator findID(const CCUnitID & id)
+    {
+        const size_t i = findIndexByID(id);
+        return i == npos ? end() : iterator(this, i);
+    }
+
+    const_iterator findID(const CCUnitID & id) const
+    {
+        const size_t i = findIndexByID(id);
+        return i == npos ? end() : const_iterator(this, i);
+    }
+
+    size_t count(const Key & key) const
+    {
+        return findIndex(key) == npos ? 0 : 1;
+    }
+
+    Value & at(const Key & key)
+    {
+        const size_t i = findIndex(key);
+        BOT_ASSERT(i != npos, "Unit not found in map");
+        return m_entries[i].second;
+    }
+
+    const Value & at(const Key & key) const
+    {
+        const size_t i = findIndex(key);
+        BOT_ASSERT(i != npos, "Unit not found in map");
+        return m_entries[i].second;
+    }
+
+    Value & operator [] (const Key & key)
+    {
+        const size_t found = findIndex(key);
+        if (found != npos)
+        {
+            return m_entries[found].second;
+        }
+
+        if ((m_used + 1) * 4 > m_states.size() * 3)
+        {
+            rehash(m_size + 1);
+        }
+
+        size_t i = HashUnitID(GetUnitKeyID(key)) & mask();
+        while (m_states[i] == Full)
+        {
+            i = (i + 1) & mask();
+        }
+
+        if (m_states[i] == Empty)
+        {
+            m_used++;
+        }
+
+        m_states[i] = Full;
+        m_entries[i] = value_type(key, Value());
+        m_size++;
+        return m_entries[i].second;
+    }
+
+    iterator erase(iterator it)
+    {
+        m_states[it.m_index] = Erased;
+        m_entries[it.m_index] = value_type();
+        m_size--;
+        return ++it;
+    }
+
+    size_t erase(const Key & key)
+    {
+        const size_t i = findIndex(key);
+        if (i == npos)
+        {
+            return 0;
+        }
+
+        erase(iterator(this, i));
+        return 1;
+    }
+
+    // keeps the slots, so a map that is refilled every frame stops allocating once it has grown
+    void clear()
+    {
+        for (size_t i(0); i < m_states.size(); ++i)
+        {
+            if (m_states[i] == Full)
+            {
+                m_entries[i] = value_type();
+            }
+        }
+
+        std::fill(m_states.begin(), m_states.end(), (uint8_t)Empty);
+        m_size = 0;
+        m_used = 0;
+    }
+
+    void reserve(size_t n)
+    {
+        if (n * 4 > m_states.size() * 3)
+        {
+            rehash(n);
+        }
+    }
+};
@@ -0,0 +1,156 @@
+#include "FlowField.h"
+#include "WalkabilityMask.h"
+#include <algorithm>
+
+const uint16_t FlowField::Unreachable;
+const uint8_t FlowField::NoDirection;
+const size_t FlowFieldCache::MaxFields;
+
+namespace
+{
+    // the four straight steps first, so a straight step wins a tie with a diagonal one
+    const int StepX[8] = { -1, 1, 0, 0, -1, 1, -1, 1 };
+    const int StepY[8] = { 0, 0, -1, 1, -1, -1, 1, 1 };
+}
+
+FlowField::FlowField()
+    : m_destination(0, 0)
+{
+
+}
+
+void FlowField::compute(const WalkabilityMask & walkable, const CCTilePosition & destination)
+{
+    const int width = walkable.width();
+    const int height = walkable.height();
+
+    m_destination = destination;
+    m_distance.reset(width, height, Unreachable);
+    m_direction.reset(width, height, NoDirection);
+
+    walkable.breadthFirstSearch(destination.x, destination.y, [this](int x, int y, int distance)
+    {
+        m_distance(x, y) = (uint16_t)distance;
+    });
+
+    for (int y(0); y < height; ++y)
+    {
+        for (int x(0); x < width; ++x)
+        {
+            const uint16_t here = m_distance(x, y);
+            if (here == Unreachable || here == 0)
+            {
+                continue;
+            }
+
+            uint16_t best = here;
+            for (uint8_t d(0); d < 8; ++d)
+            {
+                const int nx = x + StepX[d];
+                const int ny = y + StepY[d];
+                if (!m_distance.isValid(nx, ny) || m_distance(nx, ny) >= best)
+                {
+                    continue;
+                }
+
+                // a diagonal step must not cut the corner of a tile the field can't cross
+                if (d >= 4 && (m_distance(nx, y) == Unreachable || m_distance(x, ny) == Unreachable))
+                {
+                    continue;
+                }
+
+                best = m_distance(nx, ny);
+                m_direction(x, y) = d;
+            }
+        }
+    }
+}
+
+const CCTilePosition & FlowField::getDestination() const
+{
+    return m_destination;
+}
+
+int FlowField::getDistance(int tileX, int tileY) const
+{
+    if (!m_distance.isValid(tileX, tileY) || m_distance(tileX, tileY) == Unreachable)
+    {
+        return -1;
+    }
+
+    return m_distance(tileX, tileY);
+}
+
+int FlowField::getDistance(const CCPosition & pos) const
+{
+    return getDistance((int)pos.x, (int)pos.y);
+}
+
+CCTilePosition FlowField::getNextTile(const CCTilePosition & tile) const
+{
+    if (!m_direction.isValid(tile.x, tile.y) || m_direction(tile.x, tile.y) == NoDirection)
+    {
+        return tile;
+    }
+
+    const uint8_t d = m_direction(tile.x, tile.y);
+    return CCTilePosition(tile.x + StepX[d], tile.y + StepY[d]);
+}
+
+CCPosition FlowField::getWaypoint(const CCPosition & pos, int lookahead) const
+{
+    const CCPosition destination(m_destination.x + 0.5f, m_destination.y + 0.5f);
+    CCTilePosition tile((int)pos.x, (int)pos.y);
+
+    if (getDistance(tile.x, tile.y) <= lookahead)
+    {
+        return destination;
+    }
+
+    for (int step(0); step < lookahead; ++step)
+    {
+        tile = getNextTile(tile);
+    }
+
+    return CCPosition(tile.x + 0.5f, tile.y + 0.5f);
+}
+
+void FlowFieldCache::clear()
+{
+    m_entries.clear();
+}
+
+const FlowField & FlowFieldCache::get(const WalkabilityMask & walkable, const CCTilePosition & destination, int frame)
+{
+    for (auto & entry : m_entries)
+    {
+        const CCTilePosition & fieldDestination = entry.field.getDestination();
+        if (fieldDestination.x == destination.x && fieldDestination.y == destination.y)
+        {
+            entry.usedFrame = frame;
+            return entry.field;
+        }
+    }
+
+    // reuse the buffers of the field no squad has asked for the longest, but never one handed out this frame,
+    // the cache grows past MaxFields instead when every field is still in use
+    Entry * entry = nullptr;
+    if (m_entries.size() >= MaxFields)
+    {
+        auto oldest = std::min_element(m_entries.begin(), m_entries.end(), [](const Entry & a, const Entry & b) { return a.usedFrame < b.usedFrame; });
+        if (oldest->usedFrame != frame)
+        {
+            entry = &*oldest;
+        }
+    }
+
+    if (!entry)
+    {
+        m_entries.emplace_back();
+        entry = &m_entries.back();
+    }
+
+    entry->usedFrame = frame;
+    entry->field.compute(walkable, destination);
+    return entry->field;
+}
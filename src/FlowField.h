@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Common.h"
+#include "Grid2D.h"
+#include <cstdint>
+#include <deque>
+
+class WalkabilityMask;
+
+// Integration and direction fields towards one destination, shared by every unit heading there
+// the integration field is the ground distance to the destination from the BFS kernel, the same one DistanceMap uses,
+// and the direction field holds for every reached tile the neighbour one step closer, diagonals included where
+// both tiles beside the diagonal are reached too, so a unit's next tile is a single lookup
+class FlowField
+{
+    static const uint16_t   Unreachable = 0xFFFF;
+    static const uint8_t    NoDirection = 8;
+
+    CCTilePosition      m_destination;
+    Grid2D<uint16_t>    m_distance;
+    Grid2D<uint8_t>     m_direction;    // index into the step tables in FlowField.cpp, NoDirection at the destination
+
+public:
+
+    FlowField();
+
+    void    compute(const WalkabilityMask & walkable, const CCTilePosition & destination);
+
+    const CCTilePosition & getDestination() const;
+
+    // ground distance to the destination in tiles, -1 if the tile can't reach it
+    int     getDistance(const CCPosition & pos) const;
+    int     getDistance(int tileX, int tileY) const;
+
+    // the tile one step closer to the destination, the tile itself at the destination or where it can't be reached
+    CCTilePosition getNextTile(const CCTilePosition & tile) const;
+
+    // the center of the tile lookahead steps down the field from pos, the destination tile's center once it is that close
+    // or when pos can't reach it on the ground, in which case the path is left to the game
+    CCPosition getWaypoint(const CCPosition & pos, int lookahead = 8) const;
+};
+
+// The flow fields of the destinations squads are currently heading to, kept by MapTools
+// the walkable grid never changes, so a field is only computed when a destination is asked for the first time
+// and fields are only replaced once more destinations are in use than the cache holds.
+// a field asked for this frame is never replaced, so callers can hold several fields at once for the rest of the frame
+class FlowFieldCache
+{
+    struct Entry
+    {
+        FlowField   field;
+        int         usedFrame;
+    };
+
+    static const size_t MaxFields = 8;
+
+    std::deque<Entry>   m_entries;    // a deque so references to fields stay valid as it grows
+
+public:
+
+    void                clear();
+    const FlowField &   get(const WalkabilityMask & walkable, const CCTilePosition & destination, int frame);
+};
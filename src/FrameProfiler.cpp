@@ -0,0 +1,196 @@
+#include "FrameProfiler.h"
+#include "CCBot.h"
+#include <algorithm>
+#include <iomanip>
+
+const size_t FrameProfiler::WindowSize;
+
+FrameProfiler::FrameProfiler()
+    : m_frames(0)
+{
+    Scope frame;
+    frame.name        = "Frame";
+    frame.parent      = -1;
+    frame.depth       = 0;
+    frame.window.assign(WindowSize, 0.0);
+    frame.windowNext  = 0;
+    frame.windowCount = 0;
+    frame.frameTime   = 0;
+    frame.totalTime   = 0;
+    frame.maxTime     = 0;
+    frame.calls       = 0;
+
+    m_scopes.push_back(frame);
+}
+
+// scopes are looked up by name among the children of the open scope
+// the tree is small and stable after the first few frames, so a linear search is enough
+int FrameProfiler::getChild(int parent, const char * name)
+{
+    for (int child : m_scopes[parent].children)
+    {
+        if (m_scopes[child].name == name)
+        {
+            return child;
+        }
+    }
+
+    Scope scope;
+    scope.name        = name;
+    scope.parent      = parent;
+    scope.depth       = m_scopes[parent].depth + 1;
+    scope.window.assign(WindowSize, 0.0);
+    scope.windowNext  = 0;
+    scope.windowCount = 0;
+    scope.frameTime   = 0;
+    scope.totalTime   = 0;
+    scope.maxTime     = 0;
+    scope.calls       = 0;
+
+    const int index = (int)m_scopes.size();
+    m_scopes.push_back(scope);
+    m_scopes[parent].children.push_back(index);
+    return index;
+}
+
+void FrameProfiler::beginFrame()
+{
+    m_stack.clear();
+    m_stack.push_back(0);
+
+    for (auto & scope : m_scopes)
+    {
+        scope.frameTime = 0;
+    }
+
+    m_scopes[0].started = Clock::now();
+}
+
+void FrameProfiler::endFrame()
+{
+    BOT_ASSERT(m_stack.size() == 1, "Profiler scopes left open at the end of the frame: %d", (int)m_stack.size() - 1);
+
+    Scope & frame = m_scopes[0];
+    frame.frameTime = std::chrono::duration<double, std::milli>(Clock::now() - frame.started).count();
+    frame.calls++;
+    m_stack.clear();
+    m_frames++;
+
+    // every scope records a sample each frame, even if it didn't run, so the percentiles reflect the cost per frame
+    for (auto & scope : m_scopes)
+    {
+        scope.window[scope.windowNext] = scope.frameTime;
+        scope.windowNext = (scope.windowNext + 1) % WindowSize;
+        scope.windowCount = std::min(scope.windowCount + 1, WindowSize);
+        scope.totalTime += scope.frameTime;
+        scope.maxTime = std::max(scope.maxTime, scope.frameTime);
+    }
+}
+
+void FrameProfiler::start(const char * name)
+{
+    // scopes opened outside of a frame hang off the frame scope so they are still recorded
+    const int parent = m_stack.empty() ? 0 : m_stack.back();
+    const int index = getChild(parent, name);
+
+    m_scopes[index].started = Clock::now();
+    m_stack.push_back(index);
+}
+
+void FrameProfiler::stop()
+{
+    BOT_ASSERT(m_stack.size() > 1, "Profiler stop called without a matching start");
+    if (m_stack.size() <= 1)
+    {
+        return;
+    }
+
+    Scope & scope = m_scopes[m_stack.back()];
+    scope.frameTime += std::chrono::duration<double, std::milli>(Clock::now() - scope.started).count();
+    scope.calls++;
+    m_stack.pop_back();
+}
+
+FrameProfiler::Stats FrameProfiler::getStats(const Scope & scope) const
+{
+    Stats stats = { 0, 0, 0 };
+    if (scope.windowCount == 0)
+    {
+        return stats;
+    }
+
+    std::vector<double> samples(scope.window.begin(), scope.window.begin() + scope.windowCount);
+
+    const size_t p50 = (samples.size() - 1) / 2;
+    const size_t p95 = (samples.size() - 1) * 95 / 100;
+
+    std::nth_element(samples.begin(), samples.begin() + p50, samples.end());
+    stats.p50 = samples[p50];
+    std::nth_element(samples.begin(), samples.begin() + p95, samples.end());
+    stats.p95 = samples[p95];
+    stats.max = *std::max_element(samples.begin(), samples.end());
+
+    return stats;
+}
+
+void FrameProfiler::draw(CCBot & bot) const
+{
+    std::stringstream ss;
+    ss << "Module Timers (ms)             p50     p95     max\n";
+    drawScope(0, ss);
+
+    bot.Map().drawTextScreen(0.01f, 0.35f, ss.str());
+}
+
+void FrameProfiler::drawScope(int scopeIndex, std::stringstream & ss) const
+{
+    const Scope & scope = m_scopes[scopeIndex];
+    const Stats stats = getStats(scope);
+
+    const std::string label = std::string(2 * scope.depth, ' ') + scope.name;
+    ss << std::left << std::setw(28) << label << std::right << std::fixed << std::setprecision(2)
+       << std::setw(8) << stats.p50
+       << std::setw(8) << stats.p95
+       << std::setw(8) << stats.max << "\n";
+
+    for (int child : scope.children)
+    {
+        drawScope(child, ss);
+    }
+}
+
+bool FrameProfiler::writeCSV(const std::string & filename) const
+{
+    std::ofstream out(filename);
+    if (!out.is_open())
+    {
+        std::cerr << "Could not write profiler output to " << filename << "\n";
+        return false;
+    }
+
+    out << "scope,depth,calls,total_ms,mean_ms,p50_ms,p95_ms,window_max_ms,max_ms\n";
+    writeScope(out, 0, "");
+    return true;
+}
+
+void FrameProfiler::writeScope(std::ofstream & out, int scopeIndex, const std::string & parentPath) const
+{
+    const Scope & scope = m_scopes[scopeIndex];
+    const Stats stats = getStats(scope);
+    const std::string path = parentPath.empty() ? scope.name : parentPath + "/" + scope.name;
+
+    out << path << ","
+        << scope.depth << ","
+        << scope.calls << ","
+        << scope.totalTime << ","
+        << (m_frames > 0 ? scope.totalTime / m_frames : 0.0) << ","
+        << stats.p50 << ","
+        << stats.p95 << ","
+        << stats.max << ","
+        << scope.maxTime << "\n";
+
+    for (int child : scope.children)
+    {
+        writeScope(out, child, path);
+    }
+}
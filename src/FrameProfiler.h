@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Common.h"
+#include <chrono>
+#include <sstream>
+
+class CCBot;
+
+// Hierarchical per-frame profiler
+// scopes are opened and closed in a stack, so a scope opened while another is running becomes its child
+// each scope keeps the time it used in the last WindowSize frames, from which the p50 / p95 / max are computed
+class FrameProfiler
+{
+    typedef std::chrono::steady_clock Clock;
+
+    struct Scope
+    {
+        std::string         name;
+        int                 parent;
+        int                 depth;
+        std::vector<int>    children;
+
+        std::vector<double> window;         // ring buffer of the time spent in this scope per frame, in ms
+        size_t              windowNext;
+        size_t              windowCount;
+
+        double              frameTime;      // time accumulated in the current frame, in ms
+        double              totalTime;      // time accumulated over the whole game, in ms
+        double              maxTime;        // most time spent in a single frame over the whole game, in ms
+        int                 calls;
+
+        Clock::time_point   started;
+    };
+
+    struct Stats
+    {
+        double p50;
+        double p95;
+        double max;
+    };
+
+    std::vector<Scope>  m_scopes;           // scope 0 is the whole frame, every other scope descends from it
+    std::vector<int>    m_stack;
+    int                 m_frames;
+
+    int     getChild(int parent, const char * name);
+    Stats   getStats(const Scope & scope) const;
+    void    drawScope(int scopeIndex, std::stringstream & ss) const;
+    void    writeScope(std::ofstream & out, int scopeIndex, const std::string & parentPath) const;
+
+public:
+
+    static const size_t WindowSize = 256;
+
+    FrameProfiler();
+
+    void    beginFrame();
+    void    endFrame();
+
+    void    start(const char * name);
+    void    stop();
+
+    void    draw(CCBot & bot) const;
+    bool    writeCSV(const std::string & filename) const;
+};
+
+// times the enclosing block as a child of whichever profiler scope is currently open
+class ProfileScope
+{
+    FrameProfiler & m_profiler;
+
+public:
+
+    ProfileScope(FrameProfiler & profiler, const char * name)
+        : m_profiler(profiler)
+    {
+        m_profiler.start(name);
+    }
+
+    ~ProfileScope()
+    {
+        m_profiler.stop();
+    }
+};
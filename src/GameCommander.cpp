@@ -1,5 +1,6 @@
 #include "GameCommander.h"
 #include "CCBot.h"
+#include "UnitClass.h"
 #include "Util.h"
 
 GameCommander::GameCommander(CCBot & bot)
@@ -14,26 +15,34 @@ GameCommander::GameCommander(CCBot & bot)
 
 void GameCommander::onStart()
 {
+    m_supplyDepotType   = MetaType("SupplyDepot", m_bot);
+    m_barracksType      = MetaType("Barracks", m_bot);
+    m_marineType        = MetaType("Marine", m_bot);
+    m_medivacType       = MetaType("Medivac", m_bot);
+    m_scvType           = MetaType("SCV", m_bot);
+
     m_productionManager.onStart();
     m_scoutManager.onStart();
     m_combatCommander.onStart();
 
-	m_bot.setThreatTolerance(800);
+    m_bot.Events().subscribe(UnitEvents::Created, [this](const Unit & unit) { onUnitCreate(unit); });
+    m_bot.Events().subscribe(UnitEvents::Destroyed, [this](const Unit & unit) { onUnitDestroy(unit); });
+
+	// in tenths of ground DPS, about two zerglings or marines
+	m_bot.setThreatTolerance(120);
 }
 
 void GameCommander::onFrame()
 {
-    m_timer.start();
-
-    handleUnitAssignments();
-
-    m_productionManager.onFrame();
+    FrameProfiler & profiler = m_bot.Profiler();
 
-    m_scoutManager.onFrame();
-    m_combatCommander.onFrame(m_combatUnits);
+    { ProfileScope scope(profiler, "UnitAssignments");     handleUnitAssignments(); }
+    { ProfileScope scope(profiler, "ProductionManager");   m_productionManager.onFrame(); }
+    { ProfileScope scope(profiler, "ScoutManager");        m_scoutManager.onFrame(); }
+    { ProfileScope scope(profiler, "CombatCommander");     m_combatCommander.onFrame(m_combatUnits); }
 
 	//detectCurrentThreats();
-	manageThreatMap();
+	{ ProfileScope scope(profiler, "InfluenceMap");        manageInfluenceMap(); }
 
 	drawDebugInterface();
 
@@ -117,7 +126,7 @@ void GameCommander::setCombatUnits()
     {
         BOT_ASSERT(unit.isValid(), "Have a null unit in our valid units\n");
 
-        if (!isAssigned(unit) && unit.getType().isCombatUnit())
+        if (!isAssigned(unit) && unit.getType().isCombatUnit() && unit.isCompleted())
         {
             assignUnit(unit, m_combatUnits);
         }
@@ -131,7 +140,10 @@ void GameCommander::onUnitCreate(const Unit & unit)
 
 void GameCommander::onUnitDestroy(const Unit & unit)
 {
-    //_productionManager.onUnitDestroy(unit);
+    m_productionManager.onUnitDestroy(unit);
+    m_combatCommander.onUnitDestroy(unit);
+
+    m_scoutUnits.erase(std::remove(m_scoutUnits.begin(), m_scoutUnits.end(), unit), m_scoutUnits.end());
 }
 
 void GameCommander::detectCurrentThreats()
@@ -155,23 +167,22 @@ void GameCommander::detectCurrentThreats()
 		for (Unit unitt : m_bot.GetUnits()) {
 			
 			if (unitt.getPlayer() == Players::Enemy && unitt.isValid()) {
-				if (unitt.getType().getName() == "ZERG_ZERGLING") {
+				if (unitt.getType().isClass(UnitClass::ZerglingThreat)) {
 					zerglingThreat++;
 				}
-				if (unitt.getType().getName() == "ZERG_ROACH") {
+				if (unitt.getType().isClass(UnitClass::RoachThreat)) {
 					roachThreat++;
 				}
-				if (unitt.getType().getName() == "ZERG_MUTALISK" ||
-					unitt.getType().getName() == "ZERG_SPIRE") {
+				if (unitt.getType().isClass(UnitClass::AirThreat)) {
 					mutaliskThreat++;
 				}
 
 			}
 			else if (unitt.getPlayer() == Players::Self && unitt.isValid()) {
-				if (unitt.getType().getName() == "TERRAN_MISSILETURRET") {
+				if (unitt.getType().is(sc2::UNIT_TYPEID::TERRAN_MISSILETURRET)) {
 					numberOfTurrets++;
 				}
-				else if (unitt.getType().getName() == "TERRAN_BUNKER")
+				else if (unitt.getType().is(sc2::UNIT_TYPEID::TERRAN_BUNKER))
 				{
 					numberOfBunkers++;
 				}
@@ -200,14 +211,14 @@ void GameCommander::detectCurrentThreats()
 
 
 
-				m_productionManager.buildNow(MetaType("SupplyDepot", m_bot));
-				m_productionManager.buildNow(MetaType("Barracks",m_bot));
-				m_productionManager.buildNow(MetaType("Marine", m_bot));
-				m_productionManager.buildNow(MetaType("Marine", m_bot));
+				m_productionManager.buildNow(m_supplyDepotType);
+				m_productionManager.buildNow(m_barracksType);
+				m_productionManager.buildNow(m_marineType);
+				m_productionManager.buildNow(m_marineType);
 
 
-				m_productionManager.pushToMacroLoopQueue(MetaType("Marine", m_bot),20);
-				m_productionManager.pushToMacroLoopQueue(MetaType("SCV", m_bot), 10);
+				m_productionManager.pushToMacroLoopQueue(m_marineType, 20);
+				m_productionManager.pushToMacroLoopQueue(m_scvType, 10);
 
 				numberOfBunkersNeeded = 2;
 				m_bot.setThreatLevel(3);
@@ -357,10 +368,10 @@ void GameCommander::detectCurrentThreats()
 		}
 
 		for (Unit u : m_bot.UnitInfo().getUnits(Players::Self)) {
-			if (u.getType().getName() == "TERRAN_MARINE" &&
+			if (u.getType().is(sc2::UNIT_TYPEID::TERRAN_MARINE) &&
 				u.isValid()) {
 				for (Unit bunk : m_bot.UnitInfo().getUnits(Players::Self)) {
-					if (bunk.getType().getName() == "TERRAN_BUNKER") {
+					if (bunk.getType().is(sc2::UNIT_TYPEID::TERRAN_BUNKER)) {
 						if (!(bunk.getUnitPtr()->cargo_space_taken >= bunk.getUnitPtr()->cargo_space_max)) {
 							u.rightClick(bunk);
 							break;
@@ -380,8 +391,8 @@ void GameCommander::detectCurrentThreats()
 	if (m_bot.Observation()->GetFoodUsed() + 20 > m_bot.Observation()->GetFoodCap() && m_bot.Observation()->GetFoodCap() < 199
 		&& depotCDNow >= depotCDMax && m_productionManager.numberOfAutomatedItems() >= 1) {
 		//std::cout << "building two emergency depots \n";
-		m_productionManager.buildNow(MetaType("SupplyDepot", m_bot));
-		//m_productionManager.buildNow(MetaType("SupplyDepot", m_bot));
+		m_productionManager.buildNow(m_supplyDepotType);
+		//m_productionManager.buildNow(m_supplyDepotType);
 		depotCDNow = 0;
 	}
 	else {
@@ -389,9 +400,9 @@ void GameCommander::detectCurrentThreats()
 	}
 
 	if (m_productionManager.numberOfQueuedItems() <= 1 && m_productionManager.numberOfAutomatedItems() == 0) {
-		m_productionManager.pushToMacroLoopQueue(MetaType("Marine", m_bot), 10);
-		m_productionManager.pushToMacroLoopQueue(MetaType("Medivac", m_bot), 9);
-		m_productionManager.pushToMacroLoopQueue(MetaType("SCV", m_bot), 8);
+		m_productionManager.pushToMacroLoopQueue(m_marineType, 10);
+		m_productionManager.pushToMacroLoopQueue(m_medivacType, 9);
+		m_productionManager.pushToMacroLoopQueue(m_scvType, 8);
 	}
 	/**
 	if (m_productionManager.numberOfAutomatedItems() >= 1) {
@@ -399,7 +410,7 @@ void GameCommander::detectCurrentThreats()
 
 			for (Unit unitt : m_bot.GetUnits()) {
 				if (unitt.isValid() && unitt.getPlayer() == Players::Self && !unitt.isBeingConstructed()) {
-					if (unitt.getType().getName() == "TERRAN_ENGINEERINGBAY") {
+					if (unitt.getType().is(sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY)) {
 						if (unitt.getNumberOfOrders() == 0) {
 							m_productionManager.buildNow(MetaType("TerranInfantryWeaponsLevel1", m_bot));
 							m_productionManager.buildNow(MetaType("TerranInfantryArmorsLevel1", m_bot));
@@ -418,27 +429,11 @@ void GameCommander::detectCurrentThreats()
 
 }
 
-void GameCommander::manageThreatMap()
+void GameCommander::manageInfluenceMap()
 {
-	m_bot.ThreatMap().cleanMap();
-
-	for (auto u : m_bot.UnitInfo().getUnits(Players::Enemy)) {
-
-		if (u.getType().getName() == "ZERG_ZERGLING") {
-			m_bot.ThreatMap().setThreatAt(u.getPosition().x,u.getPosition().y,2,2,550,150);
-			
-		} 
-
-		if (u.getType().getName() == "ZERG_ULTRALISK") {
-			m_bot.ThreatMap().setThreatAt(u.getPosition().x, u.getPosition().y, 3, 2, 550, 150);
-		}
-
-		if (u.getType().getName() == "ZERG_MUTALISK") {
-			m_bot.ThreatMap().setThreatAt(u.getPosition().x, u.getPosition().y, 2, 2, 190, 90);
-		}
-
-	}
-	m_bot.ThreatMap().drawThreatMap();
+	// only units that moved to another tile or changed are restamped, so this is cheap enough to run every frame
+	m_bot.Influence().update();
+	m_bot.Influence().draw();
 }
 
 
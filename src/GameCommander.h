@@ -1,18 +1,16 @@
 #pragma once
 
 #include "Common.h"
-#include "Timer.hpp"
 #include "ProductionManager.h"
 #include "ScoutManager.h"
 #include "CombatCommander.h"
-#include "ThreatMap.h"
+#include "JobScheduler.h"
 
 class CCBot;
 
 class GameCommander
 {
     CCBot &                 m_bot;
-    Timer                   m_timer;
 
     ProductionManager       m_productionManager;
     ScoutManager            m_scoutManager;
@@ -24,6 +22,13 @@ class GameCommander
 
     bool                    m_initialScoutSet;
 
+    // types queued by the threat response, resolved once in onStart instead of by name every time
+    MetaType                m_supplyDepotType;
+    MetaType                m_barracksType;
+    MetaType                m_marineType;
+    MetaType                m_medivacType;
+    MetaType                m_scvType;
+
     void assignUnit(const Unit & unit, std::vector<Unit> & units);
     bool isAssigned(const Unit & unit) const;
 
@@ -55,5 +60,5 @@ public:
     void onUnitDestroy(const Unit & unit);
 
 	void detectCurrentThreats();
-	void manageThreatMap();
+	void manageInfluenceMap();
 };
@@ -0,0 +1,226 @@
+#pragma once
+
+#include "BotAssert.h"
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+// A fixed size 2D grid of tile data stored in a single contiguous row-major buffer
+// element (x, y) lives at index y * width + x, so scans should iterate y in the outer loop
+// at() is bounds-checked, operator() is unchecked and meant for tight loops that already know the tile is valid
+template <class T>
+class Grid2D
+{
+    int             m_width;
+    int             m_height;
+    std::vector<T>  m_data;
+
+public:
+
+    Grid2D()
+        : m_width (0)
+        , m_height(0)
+    {
+    }
+
+    Grid2D(int width, int height, const T & value = T())
+        : m_width (width)
+        , m_height(height)
+        , m_data  ((size_t)width * height, value)
+    {
+    }
+
+    void reset(int width, int height, const T & value = T())
+    {
+        m_width  = width;
+        m_height = height;
+        m_data.assign((size_t)width * height, value);
+    }
+
+    void fill(const T & value)
+    {
+        std::fill(m_data.begin(), m_data.end(), value);
+    }
+
+    int width() const
+    {
+        return m_width;
+    }
+
+    int height() const
+    {
+        return m_height;
+    }
+
+    size_t size() const
+    {
+        return m_data.size();
+    }
+
+    bool empty() const
+    {
+        return m_data.empty();
+    }
+
+    bool isValid(int x, int y) const
+    {
+        return x >= 0 && y >= 0 && x < m_width && y < m_height;
+    }
+
+    size_t index(int x, int y) const
+    {
+        return (size_t)y * m_width + x;
+    }
+
+    T & operator () (int x, int y)
+    {
+        return m_data[index(x, y)];
+    }
+
+    const T & operator () (int x, int y) const
+    {
+        return m_data[index(x, y)];
+    }
+
+    T & at(int x, int y)
+    {
+        BOT_ASSERT(isValid(x, y), "Grid index out of range: X = %d, Y = %d", x, y);
+        return m_data[index(x, y)];
+    }
+
+    const T & at(int x, int y) const
+    {
+        BOT_ASSERT(isValid(x, y), "Grid index out of range: X = %d, Y = %d", x, y);
+        return m_data[index(x, y)];
+    }
+
+    void set(int x, int y, const T & value)
+    {
+        at(x, y) = value;
+    }
+
+    // pointer to the first element of row y, the row holds width() elements
+    T * row(int y)
+    {
+        return m_data.data() + index(0, y);
+    }
+
+    const T * row(int y) const
+    {
+        return m_data.data() + index(0, y);
+    }
+
+    T * data()
+    {
+        return m_data.data();
+    }
+
+    const T * data() const
+    {
+        return m_data.data();
+    }
+};
+
+// bit-packed specialization for boolean tile layers
+// every row starts on a fresh 64 bit word so rows can be processed a word at a time
+template <>
+class Grid2D<bool>
+{
+    int                     m_width;
+    int                     m_height;
+    int                     m_wordsPerRow;
+    std::vector<uint64_t>   m_words;
+
+public:
+
+    Grid2D()
+        : m_width      (0)
+        , m_height     (0)
+        , m_wordsPerRow(0)
+    {
+    }
+
+    Grid2D(int width, int height, bool value = false)
+    {
+        reset(width, height, value);
+    }
+
+    void reset(int width, int height, bool value = false)
+    {
+        m_width       = width;
+        m_height      = height;
+        m_wordsPerRow = (width + 63) / 64;
+        m_words.assign((size_t)m_wordsPerRow * height, 0);
+        fill(value);
+    }
+
+    void fill(bool value)
+    {
+        std::fill(m_words.begin(), m_words.end(), value ? ~0ull : 0ull);
+
+        // keep the padding bits past the end of each row cleared so word-level counts stay exact
+        if (value && (m_width % 64) != 0)
+        {
+            const uint64_t lastWordMask = (1ull << (m_width % 64)) - 1;
+            for (int y = 0; y < m_height; ++y)
+            {
+                m_words[(size_t)y * m_wordsPerRow + m_wordsPerRow - 1] &= lastWordMask;
+            }
+        }
+    }
+
+    int width() const
+    {
+        return m_width;
+    }
+
+    int height() const
+    {
+        return m_height;
+    }
+
+    bool empty() const
+    {
+        return m_words.empty();
+    }
+
+    bool isValid(int x, int y) const
+    {
+        return x >= 0 && y >= 0 && x < m_width && y < m_height;
+    }
+
+    bool operator () (int x, int y) const
+    {
+        return (m_words[(size_t)y * m_wordsPerRow + (x >> 6)] >> (x & 63)) & 1ull;
+    }
+
+    bool at(int x, int y) const
+    {
+        BOT_ASSERT(isValid(x, y), "Grid index out of range: X = %d, Y = %d", x, y);
+        return (*this)(x, y);
+    }
+
+    void set(int x, int y, bool value)
+    {
+        BOT_ASSERT(isValid(x, y), "Grid index out of range: X = %d, Y = %d", x, y);
+        uint64_t & word = m_words[(size_t)y * m_wordsPerRow + (x >> 6)];
+        const uint64_t bit = 1ull << (x & 63);
+        word = value ? (word | bit) : (word & ~bit);
+    }
+
+    int wordsPerRow() const
+    {
+        return m_wordsPerRow;
+    }
+
+    // the packed words of row y, bit (x & 63) of word (x >> 6) holds tile (x, y)
+    uint64_t * row(int y)
+    {
+        return m_words.data() + (size_t)y * m_wordsPerRow;
+    }
+
+    const uint64_t * row(int y) const
+    {
+        return m_words.data() + (size_t)y * m_wordsPerRow;
+    }
+};
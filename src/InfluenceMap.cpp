@@ -0,0 +1,481 @@
+#include "InfluenceMap.h"
+#include "CCBot.h"
+#include "Util.h"
+#include "StampMask.h"
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define INFLUENCE_SSE2
+    #include <emmintrin.h>
+#endif
+
+const int InfluenceMap::ThreatMargin;
+
+namespace
+{
+    const int Int16Max = std::numeric_limits<int16_t>::max();
+    const int Int16Min = std::numeric_limits<int16_t>::min();
+
+    // adds value to count tiles of a row with int16 saturation, eight tiles per instruction where SSE2 is available
+    // returns true if any tile ended up at either limit, where a later subtraction would no longer be exact
+    bool AddToRow(int16_t * row, int count, int16_t value)
+    {
+        int i = 0;
+        bool saturated = false;
+
+#ifdef INFLUENCE_SSE2
+        const __m128i add = _mm_set1_epi16(value);
+        const __m128i max = _mm_set1_epi16((int16_t)Int16Max);
+        const __m128i min = _mm_set1_epi16((int16_t)Int16Min);
+        __m128i limits = _mm_setzero_si128();
+
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i * tiles = reinterpret_cast<__m128i *>(row + i);
+            const __m128i sum = _mm_adds_epi16(_mm_loadu_si128(tiles), add);
+            _mm_storeu_si128(tiles, sum);
+            limits = _mm_or_si128(limits, _mm_or_si128(_mm_cmpeq_epi16(sum, max), _mm_cmpeq_epi16(sum, min)));
+        }
+
+        saturated = _mm_movemask_epi8(limits) != 0;
+#endif
+
+        for (; i < count; ++i)
+        {
+            const int sum = std::max(Int16Min, std::min(Int16Max, row[i] + value));
+            row[i] = (int16_t)sum;
+            saturated |= sum == Int16Max || sum == Int16Min;
+        }
+
+        return saturated;
+    }
+
+    int16_t ToInt16(float value)
+    {
+        return (int16_t)std::max(0, std::min(Int16Max, (int)std::round(value)));
+    }
+}
+
+InfluenceMap::InfluenceMap(CCBot & bot)
+    : m_bot             (bot)
+    , m_touchedRows     ()
+    , m_update          (0)
+    , m_version         (0)
+    , m_layerVersions   ()
+    , m_layerChanged    ()
+    , m_saturated       (false)
+    , m_sumsTolerance   (0)
+{
+
+}
+
+void InfluenceMap::onStart()
+{
+    for (int layer(0); layer < InfluenceLayer::Count; ++layer)
+    {
+        m_layers[layer].reset(m_bot.Map().width(), m_bot.Map().height(), 0);
+        m_rowSpans[layer].assign(m_bot.Map().height(), 0);
+        m_touchedRows[layer][0] = m_bot.Map().height();
+        m_touchedRows[layer][1] = -1;
+    }
+
+    m_stamps.clear();
+    m_overToleranceSums.invalidate();
+    m_version++;
+    std::fill(m_layerVersions, m_layerVersions + InfluenceLayer::Count, m_version);
+}
+
+const InfluenceMap::TypeStamp & InfluenceMap::getTypeStamp(const Unit & unit)
+{
+    const size_t index = unit.getType().getIndex();
+    if (index >= m_typeStamps.size())
+    {
+        m_typeStamps.resize(index + 1, TypeStamp());
+    }
+
+    TypeStamp & typeStamp = m_typeStamps[index];
+    if (typeStamp.computed)
+    {
+        return typeStamp;
+    }
+
+    typeStamp = TypeStamp();
+    typeStamp.computed = true;
+
+#ifdef SC2API
+    const sc2::UnitTypeData & data = m_bot.Observation()->GetUnitTypeData()[unit.getType().getAPIUnitType()];
+
+    // a unit with several weapons for the same targets threatens them with the strongest one
+    float groundDPS = 0.0f, airDPS = 0.0f;
+    for (auto & weapon : data.weapons)
+    {
+        if (weapon.speed <= 0.0f)
+        {
+            continue;
+        }
+
+        const float dps = weapon.damage_ * weapon.attacks / weapon.speed;
+        if (weapon.type != sc2::Weapon::TargetType::Air && dps > groundDPS)
+        {
+            groundDPS = dps;
+            typeStamp.range[InfluenceLayer::GroundDPS] = weapon.range;
+        }
+
+        if (weapon.type != sc2::Weapon::TargetType::Ground && dps > airDPS)
+        {
+            airDPS = dps;
+            typeStamp.range[InfluenceLayer::AirDPS] = weapon.range;
+        }
+    }
+
+    typeStamp.value[InfluenceLayer::GroundDPS]        = ToInt16(groundDPS * 10);
+    typeStamp.value[InfluenceLayer::AirDPS]           = ToInt16(airDPS * 10);
+    typeStamp.value[InfluenceLayer::FriendlyStrength] = ToInt16(std::max(groundDPS, airDPS) * 10);
+    typeStamp.range[InfluenceLayer::FriendlyStrength] = std::max(typeStamp.range[InfluenceLayer::GroundDPS], typeStamp.range[InfluenceLayer::AirDPS]);
+    typeStamp.value[InfluenceLayer::Vision]           = 1;
+    typeStamp.range[InfluenceLayer::Vision]           = data.sight_range;
+    typeStamp.value[InfluenceLayer::Detection]        = unit.getType().isDetector() ? 1 : 0;
+    typeStamp.range[InfluenceLayer::Detection]        = data.sight_range;     // replaced by the unit's own detection range when it has one
+#endif
+
+    return typeStamp;
+}
+
+// fills in the stamp a unit should have this update, false if it should have none
+bool InfluenceMap::makeStamp(const Unit & unit, Stamp & stamp)
+{
+    if (!unit.isValid() || !unit.isCompleted())
+    {
+        return false;
+    }
+
+    const TypeStamp & typeStamp = getTypeStamp(unit);
+    const bool enemy = unit.getPlayer() == Players::Enemy;
+    const CCPosition pos = unit.getPosition();
+
+    stamp.center = CCTilePosition((int)std::floor(pos.x), (int)std::floor(pos.y));
+
+#ifdef SC2API
+    const float unitRadius = unit.getUnitPtr()->radius;
+    const float detectRange = unit.getUnitPtr()->detect_range;
+#else
+    const float unitRadius = 0.0f;
+    const float detectRange = 0.0f;
+#endif
+
+    bool stamped = false;
+    for (int layer(0); layer < InfluenceLayer::Count; ++layer)
+    {
+        // our own units only count towards friendly strength, enemies towards everything else
+        const bool applies = (layer == InfluenceLayer::FriendlyStrength) != enemy;
+
+        float range = typeStamp.range[layer] + unitRadius;
+        int margin = 0;
+        if (layer == InfluenceLayer::GroundDPS || layer == InfluenceLayer::AirDPS)
+        {
+            margin = ThreatMargin;
+        }
+        else if (layer == InfluenceLayer::Detection && detectRange > 0.0f)
+        {
+            range = detectRange;
+        }
+
+        stamp.value[layer]       = applies ? typeStamp.value[layer] : 0;
+        stamp.innerRadius[layer] = (int16_t)StampMask::ClampRadius((int)std::ceil(range));
+        stamp.radius[layer]      = (int16_t)StampMask::ClampRadius(stamp.innerRadius[layer] + margin);
+        stamped |= stamp.value[layer] > 0;
+    }
+
+    return stamped;
+}
+
+// the mask gives each row's span directly, so the only clipping is of whole spans against the map edges
+void InfluenceMap::stampDisc(int layerIndex, int cx, int cy, int radius, int value)
+{
+    Grid2D<int16_t> & layer = m_layers[layerIndex];
+    std::vector<int> & rowSpans = m_rowSpans[layerIndex];
+    const int spans = value > 0 ? 1 : -1;
+    m_layerChanged[layerIndex] = true;
+
+    const int16_t * halfWidths = StampMask::HalfWidths(radius);
+    const int y1 = std::max(0, cy - radius);
+    const int y2 = std::min(layer.height() - 1, cy + radius);
+    m_touchedRows[layerIndex][0] = std::min(m_touchedRows[layerIndex][0], y1);
+    m_touchedRows[layerIndex][1] = std::max(m_touchedRows[layerIndex][1], y2);
+
+    for (int y = y1; y <= y2; ++y)
+    {
+        const int halfWidth = halfWidths[y - cy + radius];
+        const int x1 = std::max(0, cx - halfWidth);
+        const int x2 = std::min(layer.width() - 1, cx + halfWidth);
+
+        if (x1 <= x2)
+        {
+            m_saturated |= AddToRow(layer.row(y) + x1, x2 - x1 + 1, (int16_t)value);
+            rowSpans[y] += spans;
+        }
+    }
+}
+
+// a stamp with a ring is the outer disc at the ring's value plus the inner disc at the rest of the value
+void InfluenceMap::applyStamp(const Stamp & stamp, int sign)
+{
+    for (int layer(0); layer < InfluenceLayer::Count; ++layer)
+    {
+        const int value = stamp.value[layer];
+        if (value <= 0)
+        {
+            continue;
+        }
+
+        const int ringValue = stamp.innerRadius[layer] < stamp.radius[layer] ? value / 2 : value;
+        stampDisc(layer, stamp.center.x, stamp.center.y, stamp.radius[layer], sign * ringValue);
+
+        if (ringValue != value)
+        {
+            stampDisc(layer, stamp.center.x, stamp.center.y, stamp.innerRadius[layer], sign * (value - ringValue));
+        }
+    }
+}
+
+void InfluenceMap::rebuild()
+{
+    // a row left exact by the last rebuild stays exact until it is stamped again, so only the rows stamped since
+    // need clearing, including those whose spans were all removed again but may keep a saturated leftover
+    for (int layer(0); layer < InfluenceLayer::Count; ++layer)
+    {
+        Grid2D<int16_t> & grid = m_layers[layer];
+        for (int y(m_touchedRows[layer][0]); y <= m_touchedRows[layer][1]; ++y)
+        {
+            std::fill(grid.row(y), grid.row(y) + grid.width(), (int16_t)0);
+            m_rowSpans[layer][y] = 0;
+        }
+
+        m_touchedRows[layer][0] = grid.height();
+        m_touchedRows[layer][1] = -1;
+    }
+
+    for (auto & entry : m_stamps)
+    {
+        applyStamp(entry.second, 1);
+    }
+
+    // tiles that saturate again are as exact as int16 allows, only a later stamp that saturates asks for another rebuild
+    m_saturated = false;
+}
+
+void InfluenceMap::update()
+{
+    m_update++;
+    bool changed = false;
+
+    if (m_saturated)
+    {
+        rebuild();
+        changed = true;
+    }
+
+    for (int player : { Players::Enemy, Players::Self })
+    {
+        for (auto & unit : m_bot.UnitInfo().getUnits(player))
+        {
+            Stamp stamp;
+            if (!makeStamp(unit, stamp))
+            {
+                continue;
+            }
+
+            stamp.seen = m_update;
+
+            auto it = m_stamps.find(unit.getID());
+            if (it != m_stamps.end())
+            {
+                const Stamp & old = it->second;
+                if (old.center.x == stamp.center.x && old.center.y == stamp.center.y
+                    && std::equal(old.radius, old.radius + InfluenceLayer::Count, stamp.radius)
+                    && std::equal(old.innerRadius, old.innerRadius + InfluenceLayer::Count, stamp.innerRadius)
+                    && std::equal(old.value, old.value + InfluenceLayer::Count, stamp.value))
+                {
+                    it->second.seen = m_update;
+                    continue;
+                }
+
+                applyStamp(old, -1);
+            }
+
+            applyStamp(stamp, 1);
+            m_stamps[unit.getID()] = stamp;
+            changed = true;
+        }
+    }
+
+    // units we no longer know about take their stamps with them
+    for (auto it = m_stamps.begin(); it != m_stamps.end(); )
+    {
+        if (it->second.seen != m_update)
+        {
+            applyStamp(it->second, -1);
+            it = m_stamps.erase(it);
+            changed = true;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    if (changed)
+    {
+        // only building placement reads the summed table, and only the ground threat layer feeds it
+        if (m_layerChanged[InfluenceLayer::GroundDPS])
+        {
+            m_overToleranceSums.invalidate();
+        }
+
+        m_version++;
+        for (int layer(0); layer < InfluenceLayer::Count; ++layer)
+        {
+            if (m_layerChanged[layer])
+            {
+                m_layerVersions[layer] = m_version;
+                m_layerChanged[layer] = false;
+            }
+        }
+    }
+}
+
+int InfluenceMap::getValue(int layer, int x, int y) const
+{
+    if (!m_layers[layer].isValid(x, y))
+    {
+        return 0;
+    }
+
+    return m_layers[layer](x, y);
+}
+
+int InfluenceMap::getThreatAt(int x, int y) const
+{
+    return getValue(InfluenceLayer::GroundDPS, x, y);
+}
+
+uint32_t InfluenceMap::getVersion() const
+{
+    return m_version;
+}
+
+uint32_t InfluenceMap::getVersion(int layer) const
+{
+    return m_layerVersions[layer];
+}
+
+const Grid2D<int16_t> & InfluenceMap::getLayer(int layer) const
+{
+    return m_layers[layer];
+}
+
+bool InfluenceMap::canBuildHereWithTolerance(int x, int y, int height, int width, int maxTolerance)
+{
+    const Grid2D<int16_t> & threat = m_layers[InfluenceLayer::GroundDPS];
+    if (m_overToleranceSums.isDirty() || m_sumsTolerance != maxTolerance)
+    {
+        m_overToleranceSums.build(threat.width(), threat.height(), [&threat, maxTolerance](int i, int j) { return threat(i, j) > maxTolerance ? 1 : 0; });
+        m_sumsTolerance = maxTolerance;
+    }
+
+    // the checked rectangle starts one tile below and left of the building's corner
+    return m_overToleranceSums.sum(x - 1, y - 1, width, height) == 0;
+}
+
+CCColor InfluenceMap::getColor(int threat) const
+{
+    int r = 0;
+    int g = 0;
+    int b = 0;
+
+    if (threat > 900) {
+        r = 230;
+        g = 10;
+        b = 4;
+    }
+    else if (threat > 800) {
+        r = 230;
+        g = 40;
+        b = 2;
+    }
+    else if (threat > 700) {
+        r = 231;
+        g = 80;
+        b = 0;
+    }
+    else if (threat > 600) {
+        r = 232;
+        g = 116;
+        b = 0;
+    }
+    else if (threat > 500) {
+        r = 233;
+        g = 150;
+        b = 0;
+    }
+    else if (threat > 400) {
+        r = 235;
+        g = 190;
+        b = 0;
+    }
+    else if (threat > 300) {
+        r = 240;
+        g = 230;
+        b = 0;
+    }
+    else if (threat > 200) {
+        r = 210;
+        g = 240;
+        b = 0;
+    }
+    else if (threat > 100) {
+        r = 170;
+        g = 240;
+        b = 0;
+    }
+    else if (threat > 0) {
+        r = 135;
+        g = 255;
+        b = 0;
+    }
+
+    return CCColor(r, g, b);
+}
+
+void InfluenceMap::draw()
+{
+    if (!m_bot.Config().DrawThreatMap)
+    {
+        return;
+    }
+
+    const Grid2D<int16_t> & threat = m_layers[InfluenceLayer::GroundDPS];
+    const std::vector<int> & rowSpans = m_rowSpans[InfluenceLayer::GroundDPS];
+    for (int y = 0; y < threat.height(); ++y)
+    {
+        if (rowSpans[y] == 0)
+        {
+            continue;
+        }
+
+        for (int x = 0; x < threat.width(); ++x)
+        {
+            if (threat(x, y) > 0)
+            {
+                m_bot.Map().drawTile(x, y, getColor(threat(x, y)));
+                m_bot.Map().drawText(CCPosition(x, y), std::to_string(threat(x, y)));
+            }
+        }
+    }
+
+    std::stringstream dss;
+    dss << "Threat tolerance: " << m_bot.getThreatTolerance();
+
+    m_bot.Map().drawTextScreen(0.75f, 0.10f, dss.str(), getColor(m_bot.getThreatTolerance()));
+}
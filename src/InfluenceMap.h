@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Common.h"
+#include "Grid2D.h"
+#include "FlatUnitMap.h"
+#include "SummedAreaTable.h"
+
+class CCBot;
+class Unit;
+
+namespace InfluenceLayer
+{
+    enum
+    {
+        GroundDPS,          // enemy damage per game second against ground units and buildings, in tenths
+        AirDPS,             // enemy damage per game second against air units, in tenths
+        Detection,          // number of enemy detectors covering the tile
+        Vision,             // number of enemy units that can see the tile
+        FriendlyStrength,   // our own damage per game second against anything, in tenths
+        Count
+    };
+}
+
+// Per tile influence of every unit we know about, kept in one flat int16 grid per layer
+// each unit stamps a disc on each layer it affects, sized from its type's weapon range or sight and detection range
+// and valued from its type's weapon damage, so nothing about a unit type has to be listed by hand.
+// enemy weapons stamp their full damage within range and half of it on a ring around that, see StampMask.
+// stamps are kept per unit and only redrawn when the unit changes tile or its stamp changes: the old disc is
+// subtracted and the new one added, a row span at a time with saturating int16 arithmetic.
+// a saturated tile can no longer be subtracted from exactly, so once one is seen the next update rebuilds every layer.
+// each layer counts the spans stamped on each of its rows, so drawing skips the rows nothing covers, and a rebuild
+// clears the rows stamped since the last one, since a saturated row can keep a leftover after its last span is removed
+class InfluenceMap
+{
+    struct Stamp
+    {
+        CCTilePosition  center;
+        int16_t         radius[InfluenceLayer::Count];
+        int16_t         innerRadius[InfluenceLayer::Count];    // inside it the full value, out to radius half of it
+        int16_t         value[InfluenceLayer::Count];
+        uint32_t        seen;       // the update that last saw the unit
+    };
+
+    // what a unit of a given type stamps before its own radius is added to the ranges
+    struct TypeStamp
+    {
+        bool            computed;
+        float           range[InfluenceLayer::Count];
+        int16_t         value[InfluenceLayer::Count];
+    };
+
+    // enemies are stamped at half value this many tiles past their weapon range, since they move while we act on the map
+    static const int ThreatMargin = 2;
+
+    CCBot &                         m_bot;
+    Grid2D<int16_t>                 m_layers[InfluenceLayer::Count];
+    std::vector<int>                m_rowSpans[InfluenceLayer::Count];  // stamped spans covering each row, non-zero rows are the only ones with influence
+    int                             m_touchedRows[InfluenceLayer::Count][2];    // first and last row stamped since the last rebuild
+    FlatUnitMap<CCUnitID, Stamp>    m_stamps;
+    std::vector<TypeStamp>          m_typeStamps;       // by unit type index, filled the first time a type is seen
+    uint32_t                        m_update;
+    uint32_t                        m_version;          // bumped whenever any layer changes
+    uint32_t                        m_layerVersions[InfluenceLayer::Count];     // m_version when each layer last changed
+    bool                            m_layerChanged[InfluenceLayer::Count];      // stamped since the last version bump
+    bool                            m_saturated;
+
+    // counts GroundDPS tiles above m_sumsTolerance, rebuilt on the first check after the layer or the tolerance changes
+    SummedAreaTable                 m_overToleranceSums;
+    int                             m_sumsTolerance;
+
+    const TypeStamp &   getTypeStamp(const Unit & unit);
+    bool                makeStamp(const Unit & unit, Stamp & stamp);
+    void                applyStamp(const Stamp & stamp, int sign);
+    void                stampDisc(int layer, int cx, int cy, int radius, int value);
+    void                rebuild();
+
+    CCColor             getColor(int threat) const;
+
+public:
+
+    InfluenceMap(CCBot & bot);
+
+    void        onStart();
+
+    // adds, moves and removes the stamps of units that changed since the last update
+    void        update();
+    void        draw();
+
+    int         getValue(int layer, int x, int y) const;
+    int         getThreatAt(int x, int y) const;    // the ground DPS layer, which is what threatens our buildings and workers
+    uint32_t    getVersion() const;
+    uint32_t    getVersion(int layer) const;           // only changes when that layer does, for caches built from one layer
+
+    const Grid2D<int16_t> & getLayer(int layer) const;
+
+    bool        canBuildHereWithTolerance(int x, int y, int height, int width, int maxTolerance);
+};
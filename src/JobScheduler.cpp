@@ -0,0 +1,159 @@
+#include "JobScheduler.h"
+#include "CCBot.h"
+#include <sstream>
+#include <algorithm>
+
+const JobScheduler::JobID JobScheduler::InvalidJob;
+
+JobScheduler::JobScheduler(CCBot & bot)
+    : m_bot             (bot)
+    , m_nextID          (0)
+    , m_frameStart      (Clock::now())
+    , m_running         (false)
+    , m_jobsRun         (0)
+    , m_jobsRolledOver  (0)
+{
+
+}
+
+void JobScheduler::beginFrame()
+{
+    m_frameStart = Clock::now();
+}
+
+double JobScheduler::getElapsedMs() const
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - m_frameStart).count();
+}
+
+// overdue jobs come first, then higher priority, then the earliest deadline, then the order they were scheduled in
+bool JobScheduler::runsBefore(const Entry & a, const Entry & b, int frame) const
+{
+    const bool aOverdue = a.deadlineFrame <= frame;
+    const bool bOverdue = b.deadlineFrame <= frame;
+
+    if (aOverdue != bOverdue)       { return aOverdue; }
+    if (a.priority != b.priority)   { return a.priority > b.priority; }
+    if (a.deadlineFrame != b.deadlineFrame) { return a.deadlineFrame < b.deadlineFrame; }
+    return a.id < b.id;
+}
+
+void JobScheduler::run()
+{
+    const int frame = m_bot.GetCurrentFrame();
+    const double budget = (double)m_bot.Config().StepBudgetMs;
+
+    // the queue is short, so it is simply re-sorted once per step
+    std::stable_sort(m_jobs.begin(), m_jobs.end(), [this, frame](const Entry & a, const Entry & b)
+    {
+        return runsBefore(a, b, frame);
+    });
+
+    m_jobsRun = 0;
+    m_running = true;
+
+    // jobs may schedule or cancel jobs while they run, new jobs are appended and wait for the next step
+    // and cancelled ones are only flagged, so the indices below stay valid until the loop is done
+    const size_t jobsThisStep = m_jobs.size();
+    for (size_t i(0); i < jobsThisStep; ++i)
+    {
+        if (m_jobs[i].removed)
+        {
+            continue;
+        }
+
+        // overdue jobs are sorted first, so once the budget is gone nothing after this one may run
+        const bool overdue = m_jobs[i].deadlineFrame <= frame;
+        if (!overdue && getElapsedMs() >= budget)
+        {
+            break;
+        }
+
+        m_jobsRun++;
+        if (m_jobs[i].job())
+        {
+            m_jobs[i].removed = true;
+        }
+    }
+
+    m_running = false;
+    removeFinishedJobs();
+
+    m_jobsRolledOver = (int)m_jobs.size();
+}
+
+void JobScheduler::removeFinishedJobs()
+{
+    m_jobs.erase(std::remove_if(m_jobs.begin(), m_jobs.end(), [](const Entry & entry) { return entry.removed; }), m_jobs.end());
+}
+
+JobScheduler::JobID JobScheduler::schedule(const std::string & name, int priority, int deadlineFrame, const Job & job)
+{
+    Entry entry;
+    entry.id            = m_nextID++;
+    entry.name          = name;
+    entry.priority      = priority;
+    entry.deadlineFrame = deadlineFrame;
+    entry.job           = job;
+    entry.removed       = false;
+
+    m_jobs.push_back(entry);
+    return entry.id;
+}
+
+bool JobScheduler::isPending(JobID id) const
+{
+    for (const auto & entry : m_jobs)
+    {
+        if (entry.id == id)
+        {
+            return !entry.removed;
+        }
+    }
+
+    return false;
+}
+
+void JobScheduler::cancel(JobID id)
+{
+    for (auto & entry : m_jobs)
+    {
+        if (entry.id == id)
+        {
+            entry.removed = true;
+        }
+    }
+
+    if (!m_running)
+    {
+        removeFinishedJobs();
+    }
+}
+
+size_t JobScheduler::pendingJobs() const
+{
+    return m_jobs.size();
+}
+
+int JobScheduler::jobsRun() const
+{
+    return m_jobsRun;
+}
+
+int JobScheduler::jobsRolledOver() const
+{
+    return m_jobsRolledOver;
+}
+
+void JobScheduler::draw() const
+{
+    std::stringstream ss;
+    ss << "Jobs run: " << m_jobsRun << "  rolled over: " << m_jobsRolledOver << "\n";
+
+    for (const auto & entry : m_jobs)
+    {
+        ss << "  " << entry.name << "  priority " << entry.priority << "  deadline " << entry.deadlineFrame << "\n";
+    }
+
+    m_bot.Map().drawTextScreen(0.01f, 0.75f, ss.str());
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Common.h"
+#include <chrono>
+#include <functional>
+#include <deque>
+
+class CCBot;
+
+namespace JobPriority
+{
+    enum { Low = 0, Normal = 1, High = 2 };
+}
+
+// Cooperative scheduler for work that does not have to finish on the frame that asks for it
+// jobs are drained at the end of the step, highest priority first, only while the step is still under budget
+// a job returns true once it is finished, returning false keeps it queued so long work can be split into pieces
+// jobs that are past their deadline frame still get one call per step even when the budget is spent,
+// so nothing can be starved forever, and everything else rolls over to the next step
+class JobScheduler
+{
+    typedef std::chrono::steady_clock Clock;
+
+public:
+
+    typedef int JobID;
+    typedef std::function<bool()> Job;
+
+    static const JobID InvalidJob = -1;
+
+private:
+
+    struct Entry
+    {
+        JobID       id;
+        std::string name;
+        int         priority;
+        int         deadlineFrame;
+        Job         job;
+        bool        removed;
+    };
+
+    CCBot &             m_bot;
+    std::deque<Entry>   m_jobs;             // a deque so jobs scheduled from inside a running job don't move it
+    JobID               m_nextID;
+    Clock::time_point   m_frameStart;
+    bool                m_running;
+
+    int                 m_jobsRun;          // job calls made during the last step
+    int                 m_jobsRolledOver;   // jobs still queued at the end of the last step
+
+    double  getElapsedMs() const;
+    bool    runsBefore(const Entry & a, const Entry & b, int frame) const;
+    void    removeFinishedJobs();
+
+public:
+
+    JobScheduler(CCBot & bot);
+
+    void    beginFrame();
+    void    run();
+
+    JobID   schedule(const std::string & name, int priority, int deadlineFrame, const Job & job);
+    bool    isPending(JobID id) const;
+    void    cancel(JobID id);
+
+    size_t  pendingJobs() const;
+    int     jobsRun() const;
+    int     jobsRolledOver() const;
+    void    draw() const;
+};
@@ -7,14 +7,6 @@
 #include <fstream>
 #include <array>
 
-const size_t LegalActions = 4;
-const int actionX[LegalActions] ={1, -1, 0, 0};
-const int actionY[LegalActions] ={0, 0, 1, -1};
-
-typedef std::vector<std::vector<bool>> vvb;
-typedef std::vector<std::vector<int>>  vvi;
-typedef std::vector<std::vector<float>>  vvf;
-
 #ifdef SC2API
     #define HALF_TILE 0.5f
 #else
@@ -38,6 +30,8 @@ MapTools::MapTools(CCBot & bot)
     , m_height  (0)
     , m_maxZ    (0.0f)
     , m_frame   (0)
+    , m_drawJob (JobScheduler::InvalidJob)
+    , m_placement(bot)
 	//, overseerMap()
 {
 
@@ -63,28 +57,42 @@ void MapTools::onStart()
 
 
 
-    m_walkable       = vvb(m_width, std::vector<bool>(m_height, true));
-    m_buildable      = vvb(m_width, std::vector<bool>(m_height, false));
-	m_ramp			 = vvb(m_width, std::vector<bool>(m_height, false));
-    m_depotBuildable = vvb(m_width, std::vector<bool>(m_height, false));
-    m_lastSeen       = vvi(m_width, std::vector<int>(m_height, 0));
-    m_sectorNumber   = vvi(m_width, std::vector<int>(m_height, 0));
-    m_terrainHeight  = vvf(m_width, std::vector<float>(m_height, 0.0f));
+    m_walkable      .reset(m_width, m_height, true);
+    m_buildable     .reset(m_width, m_height, false);
+	m_ramp			.reset(m_width, m_height, false);
+    m_depotBuildable.reset(m_width, m_height, false);
+    m_lastSeen      .reset(m_width, m_height, 0);
+    m_visible       .reset(m_width, m_height, false);
+    m_explored      .reset(m_width, m_height, false);
+    m_sectorNumber  .reset(m_width, m_height, 0);
+    m_terrainHeight .reset(m_width, m_height, 0.0f);
+
+    m_allMaps.clear();
+    m_allMaps.setCapacity(m_bot.Config().DistanceMapCacheSize);
+    m_flowFields.clear();
 
     // Set the boolean grid data from the Map
-    for (int x(0); x < m_width; ++x)
+    for (int y(0); y < m_height; ++y)
     {
-        for (int y(0); y < m_height; ++y)
+        for (int x(0); x < m_width; ++x)
         {
-            m_buildable[x][y]       = canBuild(x, y);
-            m_depotBuildable[x][y]  = canBuild(x, y);
-            m_walkable[x][y]        = m_buildable[x][y] || canWalk(x, y);
-            m_terrainHeight[x][y]   = m_bot.Observation()->TerrainHeight(sc2::Point2D(x + 0.5f, y + 0.5f));
+            const bool buildable = canBuild(x, y);
+            const bool walkable  = buildable || canWalk(x, y);
+
+            m_buildable.set(x, y, buildable);
+            m_depotBuildable.set(x, y, buildable);
+            m_walkable.set(x, y, walkable);
+            m_terrainHeight(x, y) = m_bot.Observation()->TerrainHeight(sc2::Point2D(x + 0.5f, y + 0.5f));
 
-			m_ramp[x][y] = m_walkable[x][y] || !m_buildable[x][y];
+			m_ramp.set(x, y, walkable || !buildable);
         }
     }
 
+    m_walkableMask.build(m_walkable);
+
+    // resources below check visibility before the first frame has been processed
+    updateVisibility();
+
 #ifdef SC2API
     for (auto & unit : m_bot.Observation()->GetUnits())
     {
@@ -112,7 +120,7 @@ void MapTools::onStart()
         {
             for (int y=tileY; y<tileY+height; ++y)
             {
-                m_buildable[x][y] = false;
+                m_buildable.set(x, y, false);
 
                 // depots can't be built within 3 tiles of any resource
                 for (int rx=-3; rx<=3; rx++)
@@ -123,7 +131,7 @@ void MapTools::onStart()
                         if (std::abs(rx) + std::abs(ry) == 6) { continue; }
                         if (!isValidTile(CCTilePosition(x+rx, y+ry))) { continue; }
 
-                        m_depotBuildable[x+rx][y+ry] = false;
+                        m_depotBuildable.set(x+rx, y+ry, false);
                     }
                 }
             }
@@ -146,7 +154,7 @@ void MapTools::onStart()
         {
             for (int y=tileY; y<tileY+resource->getType().tileHeight(); ++y)
             {
-                m_buildable[x][y] = false;
+                m_buildable.set(x, y, false);
 
                 // depots can't be built within 3 tiles of any resource
                 for (int rx=-3; rx<=3; rx++)
@@ -158,7 +166,7 @@ void MapTools::onStart()
                             continue;
                         }
 
-                        m_depotBuildable[x+rx][y+ry] = false;
+                        m_depotBuildable.set(x+rx, y+ry, false);
                     }
                 }
             }
@@ -168,37 +176,129 @@ void MapTools::onStart()
 #endif
 
     computeConnectivity();
+
+    m_placement.onStart();
+
+    // the start locations are queried all game long, so keep their distance maps around
+    for (auto & startLocation : m_bot.GetStartLocations())
+    {
+        pinDistanceMap(Util::GetTilePosition(startLocation));
+    }
 }
 
 void MapTools::onFrame()
 {
     m_frame++;
 
-    for (int x=0; x<m_width; ++x)
+    updateVisibility();
+
+    // debug drawing is the first thing to give up when the step is running long
+    if (!m_bot.Scheduler().isPending(m_drawJob))
+    {
+        m_drawJob = m_bot.Scheduler().schedule("MapDraw", JobPriority::Low, std::numeric_limits<int>::max(), [this]()
+        {
+            draw();
+            return true;
+        });
+    }
+}
+
+// decode this frame's visibility layer into the packed visible / explored grids
+// m_lastSeen is only written for tiles that were visible last frame and aren't anymore,
+// tiles that are still visible report the current frame through getLastSeen
+void MapTools::updateVisibility()
+{
+    const int wordsPerRow = m_visible.wordsPerRow();
+    std::vector<uint64_t> visibleRow(wordsPerRow);
+    std::vector<uint64_t> exploredRow(wordsPerRow);
+
+#ifdef SC2API
+    const SC2APIProtocol::Observation * observation = m_bot.Observation()->GetRawObservation();
+    if (!observation)
+    {
+        return;
+    }
+
+    const SC2APIProtocol::ImageData & visibility = observation->raw_data().map_state().visibility();
+    BOT_ASSERT(visibility.bits_per_pixel() == 8, "Visibility layer should be one byte per tile");
+
+    const std::string & pixels = visibility.data();
+    const int imageWidth  = visibility.size().x();
+    const int imageHeight = visibility.size().y();
+    const int rowWidth    = std::min(m_width, imageWidth);
+#endif
+
+    for (int y=0; y<m_height; ++y)
     {
-        for (int y=0; y<m_height; ++y)
+        std::fill(visibleRow.begin(), visibleRow.end(), 0ull);
+        std::fill(exploredRow.begin(), exploredRow.end(), 0ull);
+
+#ifdef SC2API
+        // 0 = hidden, 1 = fogged, 2 = visible, 3 = full hidden, stored top row first like the other map images
+        if (y < imageHeight)
+        {
+            const unsigned char * pixel = reinterpret_cast<const unsigned char *>(pixels.data()) + (size_t)(imageHeight - 1 - y) * imageWidth;
+            for (int x=0; x<rowWidth; ++x)
+            {
+                const uint64_t bit = 1ull << (x & 63);
+                if (pixel[x] == 2)
+                {
+                    visibleRow[x >> 6] |= bit;
+                    exploredRow[x >> 6] |= bit;
+                }
+                else if (pixel[x] == 1)
+                {
+                    exploredRow[x >> 6] |= bit;
+                }
+            }
+        }
+#else
+        for (int x=0; x<m_width; ++x)
+        {
+            const uint64_t bit = 1ull << (x & 63);
+            if (BWAPI::Broodwar->isVisible(BWAPI::TilePosition(x, y)))
+            {
+                visibleRow[x >> 6] |= bit;
+            }
+            if (BWAPI::Broodwar->isExplored(x, y))
+            {
+                exploredRow[x >> 6] |= bit;
+            }
+        }
+#endif
+
+        uint64_t * visible = m_visible.row(y);
+        uint64_t * explored = m_explored.row(y);
+        for (int w=0; w<wordsPerRow; ++w)
         {
-            if (isVisible(x, y))
+            // tiles that just went out of vision were last seen on the previous frame
+            uint64_t lostVision = visible[w] & ~visibleRow[w];
+            while (lostVision)
             {
-                m_lastSeen[x][y] = m_frame;
+                const int x = (w << 6) + WalkabilityMask::LowestSetBit(lostVision);
+                m_lastSeen(x, y) = m_frame - 1;
+                lostVision &= lostVision - 1;
             }
+
+            visible[w] = visibleRow[w];
+            explored[w] = exploredRow[w];
         }
     }
+}
 
-    draw();
+int MapTools::getLastSeen(int x, int y) const
+{
+    return m_visible(x, y) ? m_frame : m_lastSeen(x, y);
 }
 
 void MapTools::computeConnectivity()
 {
-    // the fringe data structe we will use to do our BFS searches
-    std::vector<std::array<int, 2>> fringe;
-    fringe.reserve(m_width*m_height);
     int sectorNumber = 0;
 
     // for every tile on the map, do a connected flood fill using BFS
-    for (int x=0; x<m_width; ++x)
+    for (int y=0; y<m_height; ++y)
     {
-        for (int y=0; y<m_height; ++y)
+        for (int x=0; x<m_width; ++x)
         {
             // if the sector is not currently 0, or the map isn't walkable here, then we can skip this tile
             if (getSectorNumber(x, y) != 0 || !isWalkable(x, y))
@@ -209,30 +309,11 @@ void MapTools::computeConnectivity()
             // increase the sector number, so that walkable tiles have sectors 1-N
             sectorNumber++;
 
-            // reset the fringe for the search and add the start tile to it
-            fringe.clear();
-            fringe.push_back({x,y});
-            m_sectorNumber[x][y] = sectorNumber;
-
-            // do the BFS, stopping when we reach the last element of the fringe
-            for (size_t fringeIndex=0; fringeIndex<fringe.size(); ++fringeIndex)
+            // flood fill every walkable tile connected to this one with the new sector number
+            m_walkableMask.breadthFirstSearch(x, y, [this, sectorNumber](int tileX, int tileY, int)
             {
-                auto & tile = fringe[fringeIndex];
-
-                // check every possible child of this tile
-                for (size_t a=0; a<LegalActions; ++a)
-                {
-                    int nextX = tile[0] + actionX[a];
-                    int nextY = tile[1] + actionY[a];
-
-                    // if the new tile is inside the map bounds, is walkable, and has not been assigned a sector, add it to the current sector and the fringe
-                    if (isValidTile(nextX, nextY) && isWalkable(nextX, nextY) && (getSectorNumber(nextX, nextY) == 0))
-                    {
-                        m_sectorNumber[nextX][nextY] = sectorNumber;
-                        fringe.push_back({nextX, nextY});
-                    }
-                }
-            }
+                m_sectorNumber(tileX, tileY) = sectorNumber;
+            });
         }
     }
 }
@@ -253,23 +334,14 @@ bool MapTools::isExplored(int tileX, int tileY) const
 {
     if (!isValidTile(tileX, tileY)) { return false; }
 
-#ifdef SC2API
-    sc2::Visibility vis = m_bot.Observation()->GetVisibility(CCPosition(tileX + HALF_TILE, tileY + HALF_TILE));
-    return vis == sc2::Visibility::Fogged || vis == sc2::Visibility::Visible;
-#else
-    return BWAPI::Broodwar->isExplored(tileX, tileY);
-#endif
+    return m_explored(tileX, tileY);
 }
 
 bool MapTools::isVisible(int tileX, int tileY) const
 {
     if (!isValidTile(tileX, tileY)) { return false; }
 
-#ifdef SC2API
-    return m_bot.Observation()->GetVisibility(CCPosition(tileX + HALF_TILE, tileY + HALF_TILE)) == sc2::Visibility::Visible;
-#else
-    return BWAPI::Broodwar->isVisible(BWAPI::TilePosition(tileX, tileY));
-#endif
+    return m_visible(tileX, tileY);
 }
 
 bool MapTools::isPowered(int tileX, int tileY) const
@@ -291,12 +363,12 @@ bool MapTools::isPowered(int tileX, int tileY) const
 
 float MapTools::terrainHeight(float x, float y) const
 {
-    return m_terrainHeight[(int)x][(int)y];
+    return m_terrainHeight((int)x, (int)y);
 }
 
 float MapTools::terrainHeight(sc2::Point2D pos) const
 {
-	return m_terrainHeight[static_cast<int>(pos.x)][static_cast<int>(pos.y)];
+	return m_terrainHeight(static_cast<int>(pos.x), static_cast<int>(pos.y));
 }
 
 const float MapTools::getHeight(const sc2::Point2D pos) const
@@ -316,11 +388,6 @@ const float MapTools::getHeight(const float x, const float y) const
 
 int MapTools::getGroundDistance(const CCPosition & src, const CCPosition & dest) const
 {
-    if (m_allMaps.size() > 50)
-    {
-        m_allMaps.clear();
-    }
-
     return getDistanceMap(dest).getDistance(src);
 }
 
@@ -331,15 +398,22 @@ const DistanceMap & MapTools::getDistanceMap(const CCPosition & pos) const
 
 const DistanceMap & MapTools::getDistanceMap(const CCTilePosition & tile) const
 {
-    std::pair<int,int> pairTile(tile.x, tile.y);
+    return m_allMaps.get(m_bot, tile);
+}
 
-    if (m_allMaps.find(pairTile) == m_allMaps.end())
-    {
-        m_allMaps[pairTile] = DistanceMap();
-        m_allMaps[pairTile].computeDistanceMap(m_bot, tile);
-    }
+const DistanceMap & MapTools::pinDistanceMap(const CCTilePosition & tile) const
+{
+    return m_allMaps.pin(m_bot, tile);
+}
 
-    return m_allMaps[pairTile];
+const DistanceMapCache & MapTools::getDistanceMapCache() const
+{
+    return m_allMaps;
+}
+
+const FlowField & MapTools::getFlowField(const CCPosition & destination) const
+{
+    return m_flowFields.get(m_walkableMask, Util::GetTilePosition(destination), m_bot.GetCurrentFrame());
 }
 
 int MapTools::getSectorNumber(int x, int y) const
@@ -349,7 +423,7 @@ int MapTools::getSectorNumber(int x, int y) const
         return 0;
     }
 
-    return m_sectorNumber[x][y];
+    return m_sectorNumber(x, y);
 }
 
 bool MapTools::isValidTile(int tileX, int tileY) const
@@ -486,16 +560,32 @@ bool MapTools::isBuildable(int tileX, int tileY) const
         return false;
     }
 
-    return m_buildable[tileX][tileY];
+    return m_buildable(tileX, tileY);
 }
 
 bool MapTools::canBuildTypeAtPosition(int tileX, int tileY, const UnitType & type) const
 {
-#ifdef SC2API
-    return m_bot.Query()->Placement(m_bot.Data(type).buildAbility, CCPosition((float)tileX, (float)tileY));
-#else
-    return BWAPI::Broodwar->canBuildHere(BWAPI::TilePosition(tileX, tileY), type.getAPIUnitType());
-#endif
+    return m_placement.canBuild(tileX, tileY, type);
+}
+
+void MapTools::canBuildTypeAtPositions(const std::vector<CCTilePosition> & tiles, const UnitType & type, std::vector<bool> & result) const
+{
+    m_placement.canBuild(tiles, type, result);
+}
+
+bool MapTools::canBuildTypeAtAll(const std::vector<CCTilePosition> & tiles, const UnitType & type) const
+{
+    return m_placement.canBuildAll(tiles, type);
+}
+
+bool MapTools::isPlaceable(const CCPosition & pos) const
+{
+    return m_placement.isPlaceable((int)std::floor(pos.x), (int)std::floor(pos.y));
+}
+
+bool MapTools::isFootprintClear(int tileX, int tileY, int width, int height) const
+{
+    return m_placement.isClear(tileX, tileY, width, height);
 }
 
 bool MapTools::isBuildable(const CCTilePosition & tile) const
@@ -528,7 +618,7 @@ bool MapTools::isDepotBuildableTile(int tileX, int tileY) const
         return false;
     }
 
-    return m_depotBuildable[tileX][tileY];
+    return m_depotBuildable(tileX, tileY);
 }
 
 sc2::Point2D MapTools::getWallPositionBunker() const
@@ -542,11 +632,11 @@ sc2::Point2D MapTools::getWallPositionBunker() const
 		return rampPoint;
 	}
 	int rampType = 0;
-	if (!m_bot.Observation()->IsPlacable(rampPoint + sc2::Point2D{ 0, 1 }))  // North
+	if (!isPlaceable(rampPoint + sc2::Point2D{ 0, 1 }))  // North
 	{
 		rampType += 10;
 	}
-	if (!m_bot.Observation()->IsPlacable(rampPoint + sc2::Point2D{ 1, 0 }))  // East
+	if (!isPlaceable(rampPoint + sc2::Point2D{ 1, 0 }))  // East
 	{
 		rampType += 1;
 	}
@@ -555,12 +645,12 @@ sc2::Point2D MapTools::getWallPositionBunker() const
 	{
 	case(0):  // SW
 	{
-		while (!m_bot.Observation()->IsPlacable(rampPoint + sc2::Point2D{ 1.0f, -1.0f }))
+		while (!isPlaceable(rampPoint + sc2::Point2D{ 1.0f, -1.0f }))
 		{
 			rampPoint += sc2::Point2D{ 1.0f, -1.0f };
 		}
 		int rampLength = 1;
-		while (!m_bot.Observation()->IsPlacable(rampPoint - static_cast<float>(rampLength)*sc2::Point2D{ 1.0f, -1.0f }))
+		while (!isPlaceable(rampPoint - static_cast<float>(rampLength)*sc2::Point2D{ 1.0f, -1.0f }))
 		{
 			++rampLength;
 		}
@@ -572,12 +662,12 @@ sc2::Point2D MapTools::getWallPositionBunker() const
 	}
 	case(1):  // SE
 	{
-		while (!m_bot.Observation()->IsPlacable(rampPoint + sc2::Point2D{ 1.0f, 1.0f }))
+		while (!isPlaceable(rampPoint + sc2::Point2D{ 1.0f, 1.0f }))
 		{
 			rampPoint += sc2::Point2D{ 1.0f, 1.0f };
 		}
 		int rampLength = 1;
-		while (!m_bot.Observation()->IsPlacable(rampPoint - static_cast<float>(rampLength)*sc2::Point2D{ 1.0f, 1.0f }))
+		while (!isPlaceable(rampPoint - static_cast<float>(rampLength)*sc2::Point2D{ 1.0f, 1.0f }))
 		{
 			++rampLength;
 		}
@@ -593,12 +683,12 @@ sc2::Point2D MapTools::getWallPositionBunker() const
 	}
 	case(10):  // NW
 	{
-		while (!m_bot.Observation()->IsPlacable(rampPoint + sc2::Point2D{ -1.0f, -1.0f }))
+		while (!isPlaceable(rampPoint + sc2::Point2D{ -1.0f, -1.0f }))
 		{
 			rampPoint += sc2::Point2D{ -1.0f, -1.0f };
 		}
 		int rampLength = 1;
-		while (!m_bot.Observation()->IsPlacable(rampPoint - static_cast<float>(rampLength)*sc2::Point2D{ -1.0f, -1.0f }))
+		while (!isPlaceable(rampPoint - static_cast<float>(rampLength)*sc2::Point2D{ -1.0f, -1.0f }))
 		{
 			++rampLength;
 		}
@@ -614,12 +704,12 @@ sc2::Point2D MapTools::getWallPositionBunker() const
 	}
 	case(11):  // NE
 	{
-		while (!m_bot.Observation()->IsPlacable(rampPoint + sc2::Point2D{ -1.0f, 1.0f }))
+		while (!isPlaceable(rampPoint + sc2::Point2D{ -1.0f, 1.0f }))
 		{
 			rampPoint += sc2::Point2D{ -1.0f, 1.0f };
 		}
 		int rampLength = 1;
-		while (!m_bot.Observation()->IsPlacable(rampPoint - static_cast<float>(rampLength)*sc2::Point2D{ -1.0f, 1.0f }))
+		while (!isPlaceable(rampPoint - static_cast<float>(rampLength)*sc2::Point2D{ -1.0f, 1.0f }))
 		{
 			++rampLength;
 		}
@@ -657,11 +747,11 @@ sc2::Point2D MapTools::getWallPositionDepot(const BaseLocation * base) const
 		return rampPoint;
 	}
 	int rampType = 0;
-	if (!m_bot.Observation()->IsPlacable(rampPoint + sc2::Point2D{ 0, 1 }))  // North
+	if (!isPlaceable(rampPoint + sc2::Point2D{ 0, 1 }))  // North
 	{
 		rampType += 10;
 	}
-	if (!m_bot.Observation()->IsPlacable(rampPoint + sc2::Point2D{ 1, 0 }))  // East
+	if (!isPlaceable(rampPoint + sc2::Point2D{ 1, 0 }))  // East
 	{
 		rampType += 1;
 	}
@@ -670,12 +760,12 @@ sc2::Point2D MapTools::getWallPositionDepot(const BaseLocation * base) const
 	{
 	case(0):  // SW
 	{
-		while (!m_bot.Observation()->IsPlacable(rampPoint + sc2::Point2D{ 1.0f, -1.0f }))
+		while (!isPlaceable(rampPoint + sc2::Point2D{ 1.0f, -1.0f }))
 		{
 			rampPoint += sc2::Point2D{ 1.0f, -1.0f };
 		}
 		int rampLength = 1;
-		while (!m_bot.Observation()->IsPlacable(rampPoint - static_cast<float>(rampLength)*sc2::Point2D{ 1.0f, -1.0f }))
+		while (!isPlaceable(rampPoint - static_cast<float>(rampLength)*sc2::Point2D{ 1.0f, -1.0f }))
 		{
 			++rampLength;
 		}
@@ -691,12 +781,12 @@ sc2::Point2D MapTools::getWallPositionDepot(const BaseLocation * base) const
 	}
 	case(1):  // SE
 	{
-		while (!m_bot.Observation()->IsPlacable(rampPoint + sc2::Point2D{ 1.0f, 1.0f }))
+		while (!isPlaceable(rampPoint + sc2::Point2D{ 1.0f, 1.0f }))
 		{
 			rampPoint += sc2::Point2D{ 1.0f, 1.0f };
 		}
 		int rampLength = 1;
-		while (!m_bot.Observation()->IsPlacable(rampPoint - static_cast<float>(rampLength)*sc2::Point2D{ 1.0f, 1.0f }))
+		while (!isPlaceable(rampPoint - static_cast<float>(rampLength)*sc2::Point2D{ 1.0f, 1.0f }))
 		{
 			++rampLength;
 		}
@@ -716,12 +806,12 @@ sc2::Point2D MapTools::getWallPositionDepot(const BaseLocation * base) const
 	}
 	case(10):  // NW
 	{
-		while (!m_bot.Observation()->IsPlacable(rampPoint + sc2::Point2D{ -1.0f, -1.0f }))
+		while (!isPlaceable(rampPoint + sc2::Point2D{ -1.0f, -1.0f }))
 		{
 			rampPoint += sc2::Point2D{ -1.0f, -1.0f };
 		}
 		int rampLength = 1;
-		while (!m_bot.Observation()->IsPlacable(rampPoint - static_cast<float>(rampLength)*sc2::Point2D{ -1.0f, -1.0f }))
+		while (!isPlaceable(rampPoint - static_cast<float>(rampLength)*sc2::Point2D{ -1.0f, -1.0f }))
 		{
 			++rampLength;
 		}
@@ -741,12 +831,12 @@ sc2::Point2D MapTools::getWallPositionDepot(const BaseLocation * base) const
 	}
 	case(11):  // NE
 	{
-		while (!m_bot.Observation()->IsPlacable(rampPoint + sc2::Point2D{ -1.0f, 1.0f }))
+		while (!isPlaceable(rampPoint + sc2::Point2D{ -1.0f, 1.0f }))
 		{
 			rampPoint += sc2::Point2D{ -1.0f, 1.0f };
 		}
 		int rampLength = 1;
-		while (!m_bot.Observation()->IsPlacable(rampPoint - static_cast<float>(rampLength)*sc2::Point2D{ -1.0f, 1.0f }))
+		while (!isPlaceable(rampPoint - static_cast<float>(rampLength)*sc2::Point2D{ -1.0f, 1.0f }))
 		{
 			++rampLength;
 		}
@@ -976,7 +1066,7 @@ bool MapTools::isWalkable(int tileX, int tileY) const
         return false;
     }
 
-    return m_walkable[tileX][tileY];
+    return m_walkable(tileX, tileY);
 }
 
 bool MapTools::isWalkable(const CCTilePosition & tile) const
@@ -984,6 +1074,11 @@ bool MapTools::isWalkable(const CCTilePosition & tile) const
     return isWalkable(tile.x, tile.y);
 }
 
+const WalkabilityMask & MapTools::getWalkabilityMask() const
+{
+    return m_walkableMask;
+}
+
 int MapTools::width() const
 {
     return m_width;
@@ -1008,13 +1103,10 @@ const std::vector<CCTilePosition>& MapTools::getClosestTilesTo(const sc2::Point2
 const sc2::Point2D MapTools::getClosestWalkableTo(const sc2::Point2D & pos) const
 {
 	sc2::Point2D validPos = { std::max(0.0f, std::min(pos.x, static_cast<float>(m_width))), std::max(0.0f, std::min(pos.y, static_cast<float>(m_height))) };
-	for (const auto & closestToPos : getClosestTilesTo(validPos))
+	CCTilePosition closestToPos;
+	if (findClosestTile(Util::GetTilePosition(validPos), m_width * m_height, [this](const CCTilePosition & tile) { return isWalkable(tile); }, closestToPos))
 	{
-		if (isWalkable(closestToPos))
-		{
-			
-			return sc2::Point2D(closestToPos.x, closestToPos.y);;
-		}
+		return sc2::Point2D(closestToPos.x, closestToPos.y);
 	}
 	return sc2::Point2D(0, 0);
 }
@@ -1087,7 +1179,7 @@ CCTilePosition MapTools::getLeastRecentlySeenTile() const
     {
         BOT_ASSERT(isValidTile(tile), "How is this tile not valid?");
 
-        int lastSeen = m_lastSeen[tile.x][tile.y];
+        int lastSeen = getLastSeen(tile.x, tile.y);
         if (lastSeen < minSeen)
         {
             minSeen = lastSeen;
@@ -1155,19 +1247,19 @@ sc2::Point2D MapTools::getRampPoint(const BaseLocation * base) const
 				{
 					const sc2::Point2D newPos = currentPos + i * xMove + j * yMove;
 					const int dist = enemyBaseLocation->getGroundDistance(newPos);
-					if (m_bot.Observation()->TerrainHeight(newPos) == startHeight && dist > 0 && m_bot.Observation()->IsPathable(newPos) && (m_bot.Observation()->IsPlacable(currentPos) || m_bot.Observation()->IsPlacable(newPos)))
+					if (m_bot.Observation()->TerrainHeight(newPos) == startHeight && dist > 0 && m_bot.Observation()->IsPathable(newPos) && (isPlaceable(currentPos) || isPlaceable(newPos)))
 					{
-						if ((m_bot.Observation()->IsPlacable(newPos + sc2::Point2D(0.0f, 1.0f)) || m_bot.Observation()->IsPlacable(newPos - sc2::Point2D(0.0f, 1.0f)))
-							&& (m_bot.Observation()->IsPlacable(newPos + sc2::Point2D(1.0f, 0.0f)) || m_bot.Observation()->IsPlacable(newPos - sc2::Point2D(1.0f, 0.0f))))
+						if ((isPlaceable(newPos + sc2::Point2D(0.0f, 1.0f)) || isPlaceable(newPos - sc2::Point2D(0.0f, 1.0f)))
+							&& (isPlaceable(newPos + sc2::Point2D(1.0f, 0.0f)) || isPlaceable(newPos - sc2::Point2D(1.0f, 0.0f))))
 						{
 							bool newPosBetter = false;
 							if (currentWalkingDistance > dist)  // easy
 							{
 								newPosBetter = true;
 							}
-							else if (currentWalkingDistance == dist && m_bot.Observation()->IsPlacable(currentPos))  // Now it gets complicated
+							else if (currentWalkingDistance == dist && isPlaceable(currentPos))  // Now it gets complicated
 							{
-								if (!m_bot.Observation()->IsPlacable(newPos))
+								if (!isPlaceable(newPos))
 								{
 									newPosBetter = true;
 								}
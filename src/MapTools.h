@@ -2,6 +2,13 @@
 
 #include <vector>
 #include "DistanceMap.h"
+#include "DistanceMapCache.h"
+#include "Grid2D.h"
+#include "WalkabilityMask.h"
+#include "FlowField.h"
+#include "TileFrontier.h"
+#include "PlacementCache.h"
+#include "JobScheduler.h"
 #include "UnitType.h"
 #include "BaseLocationManager.h"
 
@@ -18,24 +25,40 @@ class MapTools
     int     m_height;
     float   m_maxZ;
     int     m_frame;
+    JobScheduler::JobID m_drawJob;
 	//Overseer::MapImpl overseerMap;
 	
     
 
     // a cache of already computed distance maps, which is mutable since it only acts as a cache
-    mutable std::map<std::pair<int,int>, DistanceMap>   m_allMaps;   
+    mutable DistanceMapCache    m_allMaps;
 
-    std::vector<std::vector<bool>>  m_walkable;         // whether a tile is buildable (includes static resources)
-    std::vector<std::vector<bool>>  m_buildable;        // whether a tile is buildable (includes static resources)
-    std::vector<std::vector<bool>>  m_depotBuildable;   // whether a depot is buildable on a tile (illegal within 3 tiles of static resource)
-    std::vector<std::vector<int>>   m_lastSeen;         // the last time any of our units has seen this position on the map
-    std::vector<std::vector<int>>   m_sectorNumber;     // connectivity sector number, two tiles are ground connected if they have the same number
-    std::vector<std::vector<float>> m_terrainHeight;        // height of the map at x+0.5, y+0.5
+    Grid2D<bool>    m_walkable;         // whether a tile is buildable (includes static resources)
+    Grid2D<bool>    m_buildable;        // whether a tile is buildable (includes static resources)
+    Grid2D<bool>    m_depotBuildable;   // whether a depot is buildable on a tile (illegal within 3 tiles of static resource)
+    Grid2D<int>     m_lastSeen;         // the last frame a tile was visible, only updated when the tile drops out of vision
+    Grid2D<bool>    m_visible;          // whether a tile is visible this frame, decoded once per frame from the observation
+    Grid2D<bool>    m_explored;         // whether a tile has ever been seen (fogged or visible)
+    Grid2D<int>     m_sectorNumber;     // connectivity sector number, two tiles are ground connected if they have the same number
+    Grid2D<float>   m_terrainHeight;    // height of the map at x+0.5, y+0.5
 
-	std::vector<std::vector<bool>>   m_ramp; //custom
+	Grid2D<bool>    m_ramp; //custom
+
+    WalkabilityMask m_walkableMask;     // padded copy of m_walkable used by the BFS kernel
+
+    // scratch buffers for closest tile searches, mutable since they are only borrowed for the length of a search
+    mutable TileFrontierPool m_frontierPool;
+
+    // flow fields towards the destinations squads are moving to, mutable since it only acts as a cache
+    mutable FlowFieldCache m_flowFields;
+
+    // answers building placement checks, mutable since it only caches what it has worked out or asked the game
+    mutable PlacementCache m_placement;
 
     
     void computeConnectivity();
+    void updateVisibility();
+    int  getLastSeen(int x, int y) const;
 
     int getSectorNumber(int x, int y) const;
         
@@ -91,15 +114,23 @@ public:
     bool    isExplored(const CCTilePosition & pos) const;
     bool    isVisible(int tileX, int tileY) const;
     bool    canBuildTypeAtPosition(int tileX, int tileY, const UnitType & type) const;
+    void    canBuildTypeAtPositions(const std::vector<CCTilePosition> & tiles, const UnitType & type, std::vector<bool> & result) const;
+    bool    canBuildTypeAtAll(const std::vector<CCTilePosition> & tiles, const UnitType & type) const;
+    bool    isPlaceable(const CCPosition & pos) const;     // the map's static placement grid, without buildings or resources
+    bool    isFootprintClear(int tileX, int tileY, int width, int height) const;   // no tile unplaceable or under a building or resource
 
     const   DistanceMap & getDistanceMap(const CCTilePosition & tile) const;
     const   DistanceMap & getDistanceMap(const CCPosition & tile) const;
+    const   DistanceMap & pinDistanceMap(const CCTilePosition & tile) const;
+    const   DistanceMapCache & getDistanceMapCache() const;
+    const   FlowField & getFlowField(const CCPosition & destination) const;
     int     getGroundDistance(const CCPosition & src, const CCPosition & dest) const;
     bool    isConnected(int x1, int y1, int x2, int y2) const;
     bool    isConnected(const CCTilePosition & from, const CCTilePosition & to) const;
     bool    isConnected(const CCPosition & from, const CCPosition & to) const;
     bool    isWalkable(int tileX, int tileY) const;
     bool    isWalkable(const CCTilePosition & tile) const;
+    const   WalkabilityMask & getWalkabilityMask() const;
     
     bool    isBuildable(int tileX, int tileY) const;
     bool    isBuildable(const CCTilePosition & tile) const;
@@ -120,12 +151,24 @@ public:
     CCTilePosition getLeastRecentlySeenTile() const;
 
     // returns a list of all tiles on the map, sorted by 4-direcitonal walk distance from the given position
+    // this computes or fetches a full distance map, searches that stop early should use findClosestTile instead
     const std::vector<CCTilePosition> & getClosestTilesTo(const CCTilePosition & pos) const;
 	const std::vector<CCTilePosition> & getClosestTilesTo(const  sc2::Point2D & pos) const;
 
+    // walks tiles in the order getClosestTilesTo would list them, expanding the search only as far as it has to,
+    // and returns the first of at most maxTiles tiles pred accepts
+    template <class Pred>
+    bool    findClosestTile(const CCTilePosition & pos, size_t maxTiles, Pred pred, CCTilePosition & found) const;
+
 	const sc2::Point2D getClosestWalkableTo(const sc2::Point2D & pos) const;	//c
 	const sc2::Point2D getClosestBorderPoint(sc2::Point2D pos, int margin) const;	//c
 
 
 };
 
+template <class Pred>
+bool MapTools::findClosestTile(const CCTilePosition & pos, size_t maxTiles, Pred pred, CCTilePosition & found) const
+{
+    TileFrontier frontier(m_walkableMask, m_frontierPool, pos);
+    return frontier.find(maxTiles, pred, found);
+}
@@ -29,6 +29,9 @@ void MeleeManager::assignTargets(const std::vector<Unit> & targets)
         meleeUnitTargets.push_back(target);
     }
 
+    // the field towards the order position, only fetched once a unit has to walk there
+    const FlowField * toOrder = nullptr;
+
     // for each meleeUnit
     for (auto & meleeUnit : meleeUnits)
     {
@@ -59,8 +62,12 @@ void MeleeManager::assignTargets(const std::vector<Unit> & targets)
                 // if we're not near the order position
                 if (Util::Dist(meleeUnit, order.getPosition()) > 4)
                 {
-                    // move to it
-                    meleeUnit.move(order.getPosition());
+                    // move to it along the flow field every unit of the squad shares
+                    if (!toOrder)
+                    {
+                        toOrder = &m_bot.Map().getFlowField(order.getPosition());
+                    }
+                    meleeUnit.move(toOrder->getWaypoint(meleeUnit.getPosition()));
                 }
             }
         }
@@ -25,14 +25,12 @@ MetaType::MetaType(const std::string & name, CCBot & bot)
         return;
     }
 
-    for (const sc2::UpgradeData & data : bot.Observation()->GetUpgradeData())
+    const uint32_t upgradeID = bot.Names().getUpgradeID(name);
+    if (upgradeID != 0)
     {
-        if (name == data.name)
-        {
-            m_upgrade = data.upgrade_id;
-            m_type = MetaTypes::Upgrade;
-            return;
-        }
+        m_upgrade = sc2::UpgradeID(upgradeID);
+        m_type = MetaTypes::Upgrade;
+        return;
     }
 
     BOT_ASSERT(false, "Could not find MetaType with name: %s", name.c_str());
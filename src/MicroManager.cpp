@@ -26,41 +26,27 @@ void MicroManager::execute(const SquadOrder & inputOrder)
     std::set<Unit> nearbyEnemies;
 
     // if the order is to defend, we only care about units in the radius of the defense
+    std::vector<Unit> enemiesInRadius;
     if (order.getType() == SquadOrderTypes::Defend)
     {
-        for (auto & enemyUnit : m_bot.UnitInfo().getUnits(Players::Enemy))
-        {
-            if (Util::Dist(enemyUnit, order.getPosition()) < order.getRadius())
-            {
-                nearbyEnemies.insert(enemyUnit);
-            }
-        }
+        m_bot.Spatial().queryRadius(order.getPosition(), order.getRadius(), Players::Enemy, enemiesInRadius);
 
     } // otherwise we want to see everything on the way as well
     else if (order.getType() == SquadOrderTypes::Attack)
     {
-        for (auto & enemyUnit : m_bot.UnitInfo().getUnits(Players::Enemy))
-        {
-            if (Util::Dist(enemyUnit, order.getPosition()) < order.getRadius())
-            {
-                nearbyEnemies.insert(enemyUnit);
-            }
-        }
+        m_bot.Spatial().queryRadius(order.getPosition(), order.getRadius(), Players::Enemy, enemiesInRadius);
 
         for (auto unit : m_units)
         {
             BOT_ASSERT(unit.isValid(), "null unit in attack");
 
-            for (auto & enemyUnit : m_bot.UnitInfo().getUnits(Players::Enemy))
-            {
-                if (Util::Dist(enemyUnit, unit) < order.getRadius())
-                {
-                    nearbyEnemies.insert(enemyUnit);
-                }
-            }
+            m_bot.Spatial().queryRadius(unit.getPosition(), order.getRadius(), Players::Enemy, enemiesInRadius);
         }
     }
 
+    // squad units close together find the same enemies, the set removes the duplicates
+    nearbyEnemies.insert(enemiesInRadius.begin(), enemiesInRadius.end());
+
     std::vector<Unit> targetUnitTags;
     std::copy(nearbyEnemies.begin(), nearbyEnemies.end(), std::back_inserter(targetUnitTags));
 
@@ -116,24 +102,28 @@ const std::vector<Unit> & MicroManager::getUnits() const
 void MicroManager::regroup(const CCPosition & regroupPosition) const
 {
     CCPosition ourBasePosition = m_bot.GetStartLocation();
-    int regroupDistanceFromBase = m_bot.Map().getGroundDistance(regroupPosition, ourBasePosition);
+
+    // every unit reads its distance and next step from the same two fields instead of searching the map itself
+    const FlowField & toBase = m_bot.Map().getFlowField(ourBasePosition);
+    const FlowField & toRegroup = m_bot.Map().getFlowField(regroupPosition);
+    int regroupDistanceFromBase = toBase.getDistance(regroupPosition);
 
     // for each of the units we have
     for (auto unit : m_units)
     {
         BOT_ASSERT(unit.isValid(), "null unit in MicroManager regroup");
 
-        int unitDistanceFromBase = m_bot.Map().getGroundDistance(unit.getPosition(), ourBasePosition);
+        int unitDistanceFromBase = toBase.getDistance(unit.getPosition());
 
         // if the unit is outside the regroup area
         if (unitDistanceFromBase > regroupDistanceFromBase)
         {
-            unit.move(ourBasePosition);
+            unit.move(toBase.getWaypoint(unit.getPosition()));
         }
         else if (Util::Dist(unit, regroupPosition) > 4)
         {
             // regroup it
-            unit.move(regroupPosition);
+            unit.move(toRegroup.getWaypoint(unit.getPosition()));
         }
         else
         {
@@ -0,0 +1,75 @@
+#include "NameRegistry.h"
+#include "CCBot.h"
+
+NameRegistry::NameRegistry()
+    : m_built(false)
+{
+
+}
+
+void NameRegistry::build(CCBot & bot)
+{
+    m_unitTypes.clear();
+    m_upgrades.clear();
+    m_buffs.clear();
+    m_abilities.clear();
+
+#ifdef SC2API
+    for (const sc2::UnitTypeData & data : bot.Observation()->GetUnitTypeData())
+    {
+        m_unitTypes.emplace(data.name, (uint32_t)data.unit_type_id);
+    }
+
+    for (const sc2::UpgradeData & data : bot.Observation()->GetUpgradeData())
+    {
+        m_upgrades.emplace(data.name, (uint32_t)data.upgrade_id);
+    }
+
+    for (const sc2::BuffData & data : bot.Observation()->GetBuffData())
+    {
+        m_buffs.emplace(data.name, (uint32_t)data.buff_id);
+    }
+
+    for (const sc2::AbilityData & data : bot.Observation()->GetAbilityData())
+    {
+        m_abilities.emplace(data.link_name, (uint32_t)data.ability_id);
+    }
+#endif
+
+    m_built = true;
+}
+
+bool NameRegistry::isBuilt() const
+{
+    return m_built;
+}
+
+uint32_t NameRegistry::Find(const NameMap & names, const std::string & name)
+{
+    auto it = names.find(name);
+    return it == names.end() ? 0 : it->second;
+}
+
+uint32_t NameRegistry::getUnitTypeID(const std::string & name) const
+{
+    BOT_ASSERT(m_built, "Name registry used before it was built: %s", name.c_str());
+    return Find(m_unitTypes, name);
+}
+
+uint32_t NameRegistry::getUpgradeID(const std::string & name) const
+{
+    BOT_ASSERT(m_built, "Name registry used before it was built: %s", name.c_str());
+    return Find(m_upgrades, name);
+}
+
+uint32_t NameRegistry::getBuffID(const std::string & name) const
+{
+    BOT_ASSERT(m_built, "Name registry used before it was built: %s", name.c_str());
+    return Find(m_buffs, name);
+}
+
+uint32_t NameRegistry::getAbilityID(const std::string & name) const
+{
+    BOT_ASSERT(m_built, "Name registry used before it was built: %s", name.c_str());
+    return Find(m_abilities, name);
+}
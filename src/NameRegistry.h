@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Common.h"
+#include <unordered_map>
+
+class CCBot;
+
+// Hashed name to ID lookups for unit types, upgrades, buffs and abilities
+// the game data arrays hold thousands of entries, so they are indexed once at game start
+// instead of being scanned linearly every time a name is resolved
+// when several entries share a name the first one wins, which is what the linear scans returned
+class NameRegistry
+{
+    typedef std::unordered_map<std::string, uint32_t> NameMap;
+
+    NameMap m_unitTypes;
+    NameMap m_upgrades;
+    NameMap m_buffs;
+    NameMap m_abilities;        // keyed by the ability's link name
+    bool    m_built;
+
+    static uint32_t Find(const NameMap & names, const std::string & name);
+
+public:
+
+    NameRegistry();
+
+    void build(CCBot & bot);
+    bool isBuilt() const;
+
+    // each lookup returns 0, the invalid ID, if the name is unknown
+    uint32_t getUnitTypeID(const std::string & name) const;
+    uint32_t getUpgradeID(const std::string & name) const;
+    uint32_t getBuffID(const std::string & name) const;
+    uint32_t getAbilityID(const std::string & name) const;
+};
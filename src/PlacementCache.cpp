@@ -0,0 +1,380 @@
+#include "PlacementCache.h"
+#include "CCBot.h"
+#include <algorithm>
+#include <cmath>
+
+const int PlacementCache::RebuildInterval;
+
+namespace
+{
+    // the tiles a footprint of the given width covers along one axis when centered on tile corner c
+    // odd widths are centered on a tile center, so the game may shift them half a tile either way:
+    // the inner range is covered whichever way it goes, the outer range contains both possibilities
+    void FootprintRange(int c, int width, int & innerLo, int & innerHi, int & outerLo, int & outerHi)
+    {
+        if (width % 2 == 0)
+        {
+            innerLo = outerLo = c - width / 2;
+            innerHi = outerHi = c + width / 2;
+        }
+        else
+        {
+            innerLo = c - (width - 1) / 2;
+            innerHi = c + (width - 1) / 2;
+            outerLo = c - (width + 1) / 2;
+            outerHi = c + (width + 1) / 2;
+        }
+    }
+}
+
+PlacementCache::PlacementCache(CCBot & bot)
+    : m_bot             (bot)
+    , m_dirty           (true)
+    , m_builtFrame      (0)
+    , m_localAnswers    (0)
+    , m_queriedAnswers  (0)
+{
+
+}
+
+void PlacementCache::onStart()
+{
+#ifdef SC2API
+    const sc2::GameInfo & info = m_bot.Observation()->GetGameInfo();
+    m_placeable.reset(info.width, info.height, false);
+    m_blocked.reset(info.width, info.height, Free);
+    m_nearResource.reset(info.width, info.height, false);
+
+    // the placement grid is stored top row first
+    for (int y(0); y < info.height; ++y)
+    {
+        for (int x(0); x < info.width; ++x)
+        {
+            const unsigned char encodedPlacement = info.placement_grid.data[x + ((info.height - 1) - y) * info.width];
+            m_placeable.set(x, y, encodedPlacement == 255);
+        }
+    }
+
+    m_bot.Events().subscribe(UnitEvents::Created,     [this](const Unit & unit) { onUnitChanged(unit); });
+    m_bot.Events().subscribe(UnitEvents::Destroyed,   [this](const Unit & unit) { onUnitChanged(unit); });
+    m_bot.Events().subscribe(UnitEvents::EnterVision, [this](const Unit & unit) { onUnitChanged(unit); });
+#endif
+
+    m_answers.clear();
+    m_dirty = true;
+}
+
+void PlacementCache::onUnitChanged(const Unit & unit)
+{
+    if (m_dirty)
+    {
+        return;
+    }
+
+    const UnitType type = unit.getType();
+    if (type.isBuilding() || type.isMineral() || type.isGeyser() || unit.getPlayer() == Players::Neutral)
+    {
+        m_dirty = true;
+    }
+}
+
+bool PlacementCache::isPlaceable(int tileX, int tileY) const
+{
+    return m_placeable.isValid(tileX, tileY) && m_placeable(tileX, tileY);
+}
+
+bool PlacementCache::isClear(int tileX, int tileY, int width, int height)
+{
+#ifdef SC2API
+    rebuildIfNeeded();
+    return tileX >= 0 && tileY >= 0 && tileX + width <= m_placeable.width() && tileY + height <= m_placeable.height()
+        && m_unbuildableSums.sum(tileX, tileY, width, height) == 0;
+#else
+    return true;
+#endif
+}
+
+void PlacementCache::markFootprint(int x1, int y1, int width, int height, uint8_t state)
+{
+    for (int y = std::max(0, y1); y < std::min(m_blocked.height(), y1 + height); ++y)
+    {
+        for (int x = std::max(0, x1); x < std::min(m_blocked.width(), x1 + width); ++x)
+        {
+            // a known footprint wins over an uncertain one
+            m_blocked(x, y) = std::max(m_blocked(x, y), state);
+        }
+    }
+}
+
+void PlacementCache::rebuildIfNeeded()
+{
+    if (m_dirty || m_bot.GetCurrentFrame() - m_builtFrame >= RebuildInterval)
+    {
+        rebuild();
+    }
+}
+
+void PlacementCache::rebuild()
+{
+#ifdef SC2API
+    m_blocked.fill(Free);
+    m_nearResource.fill(false);
+
+    for (auto & unit : m_bot.GetUnits())
+    {
+        if (unit.isFlying())
+        {
+            continue;
+        }
+
+        const UnitType type = unit.getType();
+        const CCPosition pos = unit.getPosition();
+
+        if (type.isMineral() || type.isGeyser())
+        {
+            // the same footprint and town hall exclusion zone MapTools uses for the resources it sees at the start
+            const int width = type.tileWidth();
+            const int height = type.tileHeight();
+            const int tileX = (int)std::floor(pos.x) - (width / 2);
+            const int tileY = (int)std::floor(pos.y) - (height / 2);
+            markFootprint(tileX, tileY, width, height, Occupied);
+
+            for (int x = tileX - 3; x < tileX + width + 3; ++x)
+            {
+                for (int y = tileY - 3; y < tileY + height + 3; ++y)
+                {
+                    if (!m_nearResource.isValid(x, y)) { continue; }
+
+                    const int dx = x < tileX ? tileX - x : (x >= tileX + width ? x - (tileX + width - 1) : 0);
+                    const int dy = y < tileY ? tileY - y : (y >= tileY + height ? y - (tileY + height - 1) : 0);
+                    if (dx + dy == 6) { continue; }
+
+                    m_nearResource.set(x, y, true);
+                }
+            }
+        }
+        else if (type.isBuilding())
+        {
+            const int width = type.tileWidth();
+            const int height = type.tileHeight();
+            markFootprint((int)std::floor(pos.x - width / 2.0f + 0.5f), (int)std::floor(pos.y - height / 2.0f + 0.5f), width, height, Occupied);
+        }
+        else if (unit.getPlayer() == Players::Neutral)
+        {
+            // rocks and other neutral obstacles have footprints we don't know, so the area they may cover is left to the game
+            const float radius = unit.getUnitPtr()->radius + 1.0f;
+            const int x1 = (int)std::floor(pos.x - radius);
+            const int y1 = (int)std::floor(pos.y - radius);
+            markFootprint(x1, y1, (int)std::ceil(pos.x + radius) - x1, (int)std::ceil(pos.y + radius) - y1, Uncertain);
+        }
+    }
+
+    m_unbuildableSums.build(m_blocked.width(), m_blocked.height(), [this](int x, int y)
+    {
+        return (!m_placeable(x, y) || m_blocked(x, y) == Occupied) ? 1 : 0;
+    });
+
+    // the game's answers depend on the structures, which may have changed
+    m_answers.clear();
+#endif
+
+    m_dirty = false;
+    m_builtFrame = m_bot.GetCurrentFrame();
+}
+
+int PlacementCache::predict(int tileX, int tileY, const UnitType & type) const
+{
+#ifdef SC2API
+    // refineries go on geysers and addons are placed by their producer, both are left to the game
+    if (!type.isBuilding() || type.isRefinery() || type.isAddon())
+    {
+        return Unknown;
+    }
+
+    const int width = type.tileWidth();
+    const int height = type.tileHeight();
+    if (width <= 0 || height <= 0)
+    {
+        return Unknown;
+    }
+
+    int innerX1, innerX2, outerX1, outerX2, innerY1, innerY2, outerY1, outerY2;
+    FootprintRange(tileX, width, innerX1, innerX2, outerX1, outerX2);
+    FootprintRange(tileY, height, innerY1, innerY2, outerY1, outerY2);
+
+    // most candidates in a crowded base fail on a blocked tile, which the summed table finds without the tile loop
+    if (innerX1 < 0 || innerY1 < 0 || innerX2 > m_placeable.width() || innerY2 > m_placeable.height()
+        || m_unbuildableSums.sum(innerX1, innerY1, innerX2 - innerX1, innerY2 - innerY1) > 0)
+    {
+        return No;
+    }
+
+    const CCRace race = type.getRace();
+    const bool isDepot = type.isResourceDepot();
+    const bool needsCreep = race == sc2::Race::Zerg && !isDepot;
+    const bool avoidsCreep = race != sc2::Race::Zerg;
+    const bool needsPower = race == sc2::Race::Protoss && !isDepot && !type.isSupplyProvider();
+
+    int prediction = needsPower ? Unknown : Yes;
+    for (int y = outerY1; y < outerY2; ++y)
+    {
+        for (int x = outerX1; x < outerX2; ++x)
+        {
+            const bool inner = x >= innerX1 && x < innerX2 && y >= innerY1 && y < innerY2;
+
+            bool fails = !m_placeable.isValid(x, y) || !m_placeable(x, y) || m_blocked(x, y) == Occupied || (isDepot && m_nearResource(x, y));
+            bool uncertain = m_placeable.isValid(x, y) && m_blocked(x, y) == Uncertain;
+
+            if (!fails && (needsCreep || avoidsCreep))
+            {
+                const bool creep = m_bot.Observation()->HasCreep(CCPosition(x + 0.5f, y + 0.5f));
+                fails = needsCreep ? !creep : creep;
+            }
+
+            // a failing tile inside the footprint fails the placement, anywhere else it only makes it uncertain
+            if (fails && inner)
+            {
+                return No;
+            }
+
+            if (fails || uncertain)
+            {
+                prediction = Unknown;
+            }
+        }
+    }
+
+    return prediction;
+#else
+    return Unknown;
+#endif
+}
+
+bool PlacementCache::canBuild(int tileX, int tileY, const UnitType & type)
+{
+#ifdef SC2API
+    rebuildIfNeeded();
+
+    const int prediction = predict(tileX, tileY, type);
+    if (prediction != Unknown)
+    {
+        m_localAnswers++;
+        return prediction == Yes;
+    }
+
+    const sc2::AbilityID ability = m_bot.Data(type).buildAbility;
+    const auto key = std::make_pair((uint32_t)ability, tileY * m_placeable.width() + tileX);
+    auto it = m_answers.find(key);
+    if (it != m_answers.end())
+    {
+        m_localAnswers++;
+        return it->second;
+    }
+
+    m_queriedAnswers++;
+    const bool result = m_bot.Query()->Placement(ability, CCPosition((float)tileX, (float)tileY));
+    m_answers[key] = result;
+    return result;
+#else
+    return BWAPI::Broodwar->canBuildHere(BWAPI::TilePosition(tileX, tileY), type.getAPIUnitType());
+#endif
+}
+
+void PlacementCache::canBuild(const std::vector<CCTilePosition> & tiles, const UnitType & type, std::vector<bool> & result)
+{
+    result.assign(tiles.size(), false);
+
+#ifdef SC2API
+    rebuildIfNeeded();
+
+    const sc2::AbilityID ability = m_bot.Data(type).buildAbility;
+    std::vector<sc2::QueryInterface::PlacementQuery> queries;
+    std::vector<size_t> queried;
+
+    for (size_t i(0); i < tiles.size(); ++i)
+    {
+        const int prediction = predict(tiles[i].x, tiles[i].y, type);
+        if (prediction != Unknown)
+        {
+            m_localAnswers++;
+            result[i] = prediction == Yes;
+            continue;
+        }
+
+        auto it = m_answers.find(std::make_pair((uint32_t)ability, tiles[i].y * m_placeable.width() + tiles[i].x));
+        if (it != m_answers.end())
+        {
+            m_localAnswers++;
+            result[i] = it->second;
+            continue;
+        }
+
+        queries.push_back(sc2::QueryInterface::PlacementQuery(ability, CCPosition((float)tiles[i].x, (float)tiles[i].y)));
+        queried.push_back(i);
+    }
+
+    if (queries.empty())
+    {
+        return;
+    }
+
+    m_queriedAnswers += queries.size();
+    const std::vector<bool> answers = m_bot.Query()->Placement(queries);
+    for (size_t q(0); q < queried.size() && q < answers.size(); ++q)
+    {
+        const CCTilePosition & tile = tiles[queried[q]];
+        result[queried[q]] = answers[q];
+        m_answers[std::make_pair((uint32_t)ability, tile.y * m_placeable.width() + tile.x)] = answers[q];
+    }
+#else
+    for (size_t i(0); i < tiles.size(); ++i)
+    {
+        result[i] = canBuild(tiles[i].x, tiles[i].y, type);
+    }
+#endif
+}
+
+bool PlacementCache::canBuildAll(const std::vector<CCTilePosition> & tiles, const UnitType & type)
+{
+#ifdef SC2API
+    rebuildIfNeeded();
+
+    const sc2::AbilityID ability = m_bot.Data(type).buildAbility;
+    std::vector<CCTilePosition> unknown;
+
+    for (auto & tile : tiles)
+    {
+        const int prediction = predict(tile.x, tile.y, type);
+        if (prediction == No)
+        {
+            m_localAnswers++;
+            return false;
+        }
+
+        if (prediction == Unknown)
+        {
+            auto it = m_answers.find(std::make_pair((uint32_t)ability, tile.y * m_placeable.width() + tile.x));
+            if (it == m_answers.end())
+            {
+                unknown.push_back(tile);
+            }
+            else if (!it->second)
+            {
+                m_localAnswers++;
+                return false;
+            }
+        }
+    }
+
+    std::vector<bool> result;
+    canBuild(unknown, type, result);
+    return std::find(result.begin(), result.end(), false) == result.end();
+#else
+    for (auto & tile : tiles)
+    {
+        if (!canBuild(tile.x, tile.y, type)) { return false; }
+    }
+
+    return true;
+#endif
+}
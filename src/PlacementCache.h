@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Common.h"
+#include "Grid2D.h"
+#include "UnitType.h"
+#include "SummedAreaTable.h"
+#include <map>
+
+class CCBot;
+class Unit;
+
+// Answers "can this building type be placed at this tile" for MapTools, asking the game as little as possible
+// a local placement grid is kept from the map's static placement data plus the footprints of the structures,
+// resources and neutral obstacles we can see, rebuilt whenever one of them is created or destroyed.
+// a check the local grid can decide is answered locally, the rest go to the game, several at once when the
+// caller has several tiles to check, and the game's answers are cached until the structures change
+class PlacementCache
+{
+    enum : uint8_t { Free = 0, Uncertain = 1, Occupied = 2 };
+    enum { No, Yes, Unknown };
+
+    // footprints are only rebuilt from events, so this catches what no event reports, like a building lifting off
+    static const int RebuildInterval = 22;
+
+    CCBot &         m_bot;
+    Grid2D<bool>    m_placeable;        // the map's static placement grid
+    Grid2D<uint8_t> m_blocked;          // Free, Uncertain under an obstacle of unknown shape, or Occupied by a footprint
+    Grid2D<bool>    m_nearResource;     // tiles within 3 of a resource, where town halls can't be placed
+    SummedAreaTable m_unbuildableSums;  // counts tiles that are unplaceable or Occupied, rebuilt with the footprints
+    bool            m_dirty;
+    int             m_builtFrame;
+
+    std::map<std::pair<uint32_t, int>, bool> m_answers;    // (build ability, tile index) answers from the game
+
+    size_t          m_localAnswers;
+    size_t          m_queriedAnswers;
+
+    void    rebuildIfNeeded();
+    void    rebuild();
+    void    markFootprint(int x1, int y1, int width, int height, uint8_t state);
+    void    onUnitChanged(const Unit & unit);
+    int     predict(int tileX, int tileY, const UnitType & type) const;
+
+public:
+
+    PlacementCache(CCBot & bot);
+
+    void    onStart();
+
+    bool    isPlaceable(int tileX, int tileY) const;
+
+    // true if no tile of the rectangle is unplaceable or under a known footprint, no building can cover one that is
+    bool    isClear(int tileX, int tileY, int width, int height);
+
+    bool    canBuild(int tileX, int tileY, const UnitType & type);
+
+    // checks every tile, sending the ones that can't be answered locally to the game in one query
+    void    canBuild(const std::vector<CCTilePosition> & tiles, const UnitType & type, std::vector<bool> & result);
+
+    // true if the type can be placed at all of the tiles, stopping before any query once one tile is known to fail
+    bool    canBuildAll(const std::vector<CCTilePosition> & tiles, const UnitType & type);
+
+    size_t  getLocalAnswers() const     { return m_localAnswers; }
+    size_t  getQueriedAnswers() const   { return m_queriedAnswers; }
+};
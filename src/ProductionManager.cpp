@@ -1,6 +1,7 @@
 #include "ProductionManager.h"
 #include "Util.h"
 #include "CCBot.h"
+#include "UnitClass.h"
 #include <cstdlib>
 #include <math.h>
 
@@ -8,6 +9,7 @@ ProductionManager::ProductionManager(CCBot & bot)
     : m_bot             (bot)
     , m_buildingManager (bot)
     , m_queue           (bot)
+    , m_abilityPredictor(bot)
 {
 
 }
@@ -63,6 +65,8 @@ void ProductionManager::manageBuildOrderQueue()
         return;
     }
 
+    m_abilityPredictor.update();
+
     // the current item to be used
     BuildOrderItem & currentItem = m_queue.getHighestPriorityItem();
 
@@ -250,10 +254,16 @@ Unit ProductionManager::getProducer(const MetaType & type, CCPosition closestTo,
 	std::vector<Unit> finalCandidateProducers;
 	size_t leastAmountOfOrders = 10;
 
-    for (auto unit : m_bot.UnitInfo().getUnits(Players::Self))
+    // only the units of the producer types are looked at, through the per type unit lists
+    std::vector<Unit> producers;
+    for (auto & producerType : producerTypes)
+    {
+        m_bot.UnitInfo().getUnitsOfType(Players::Self, producerType, producers);
+    }
+
+    for (auto unit : producers)
     {
         // reasons a unit can not train the desired type
-        if (std::find(producerTypes.begin(), producerTypes.end(), unit.getType()) == producerTypes.end()) { continue; }
         if (!unit.isCompleted()) { continue; }
         
 		
@@ -350,10 +360,15 @@ int ProductionManager::numberOfViableProducers(const MetaType & type, CCPosition
 
 	int freeSlots = 0;
 
-	for (auto unit : m_bot.UnitInfo().getUnits(Players::Self))
+	std::vector<Unit> producers;
+	for (auto & producerType : producerTypes)
+	{
+		m_bot.UnitInfo().getUnitsOfType(Players::Self, producerType, producers);
+	}
+
+	for (auto unit : producers)
 	{
 		// reasons a unit can not train the desired type
-		if (std::find(producerTypes.begin(), producerTypes.end(), unit.getType()) == producerTypes.end()) { continue; }
 		if (!unit.isCompleted()) { continue; }
 
 
@@ -431,7 +446,7 @@ void ProductionManager::create(const Unit & producer, BuildOrderItem & item)
         }
         else
         {
-			if (item.type.getUnitType().getName() == "TERRAN_BARRACKS") {
+			if (item.type.getUnitType().is(sc2::UNIT_TYPEID::TERRAN_BARRACKS)) {
 				int numberOfBarracks = 0;
 				int numberOfDepots = 0;
 				CCPosition depotPos;
@@ -439,11 +454,10 @@ void ProductionManager::create(const Unit & producer, BuildOrderItem & item)
 
 				for (auto & unit : m_bot.UnitInfo().getUnits(Players::Self)) {
 
-					if (unit.getType().getName() == "TERRAN_BARRACKS") {
+					if (unit.getType().is(sc2::UNIT_TYPEID::TERRAN_BARRACKS)) {
 						numberOfBarracks++;
 					}
-					else if (unit.getType().getName() == "TERRAN_SUPPLYDEPOTLOWERED" ||
-						unit.getType().getName() == "TERRAN_SUPPLYDEPOT") {
+					else if (unit.getType().isClass(UnitClass::SupplyDepot)) {
 						numberOfDepots++;
 						depotPos = unit.getPosition();
 					}
@@ -459,16 +473,16 @@ void ProductionManager::create(const Unit & producer, BuildOrderItem & item)
 				}
 
 			} else 
-			if (item.type.getUnitType().getName() == "TERRAN_STARPORT") {
+			if (item.type.getUnitType().is(sc2::UNIT_TYPEID::TERRAN_STARPORT)) {
 				for (auto & unit : m_bot.UnitInfo().getUnits(Players::Self)) {
-					if (unit.getType().getName() == "TERRAN_FACTORY") {
+					if (unit.getType().is(sc2::UNIT_TYPEID::TERRAN_FACTORY)) {
 						m_buildingManager.addBuildingTask(item.type.getUnitType(), Util::GetTilePosition(unit.getPosition()));
 						break;
 					}
 				}
 				//find location for missile turrets
 			} else
-			if (item.type.getUnitType().getName() == "TERRAN_MISSILETURRET") {
+			if (item.type.getUnitType().is(sc2::UNIT_TYPEID::TERRAN_MISSILETURRET)) {
 				const BaseLocation *chosenBase;
 				int leastTurrets = 100;
 
@@ -498,7 +512,7 @@ void ProductionManager::create(const Unit & producer, BuildOrderItem & item)
 				}
 				
 			}
-			else if (item.type.getUnitType().getName() == "TERRAN_ENGINEERINGBAY" || item.type.getUnitType().getName() == "TERRAN_ARMORY") {
+			else if (item.type.getUnitType().is(sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY) || item.type.getUnitType().is(sc2::UNIT_TYPEID::TERRAN_ARMORY)) {
 				for (auto & base : m_bot.Bases().getOccupiedBaseLocations(Players::Self)) {
 					if (base->isStartLocation()) {
 						m_buildingManager.addBuildingTask(item.type.getUnitType(), Util::GetTilePosition(base->m_behindMineralLine));
@@ -506,7 +520,7 @@ void ProductionManager::create(const Unit & producer, BuildOrderItem & item)
 					}
 				}
 			}
-			 else if (item.type.getUnitType().getName() == "TERRAN_BUNKER") {
+			 else if (item.type.getUnitType().is(sc2::UNIT_TYPEID::TERRAN_BUNKER)) {
 
 				 sc2::Point2D bPoint(0.0, 0.0);
 
@@ -692,7 +706,7 @@ void ProductionManager::ManageOCEnergy()
 	int unitEnergy;
 	for (auto & unit : m_bot.UnitInfo().getUnits(Players::Self))
 	{
-		if (unit.getType().getName() == "TERRAN_ORBITALCOMMAND")
+		if (unit.getType().is(sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMAND))
 		{
 			unitEnergy = unit.getEnergy();
 
@@ -752,35 +766,7 @@ bool ProductionManager::canMakeNow(const Unit & producer, const MetaType & type)
     }
 
 #ifdef SC2API
-    sc2::AvailableAbilities available_abilities = m_bot.Query()->GetAbilitiesForUnit(producer.getUnitPtr());
-
-    // quick check if the unit can't do anything it certainly can't build the thing we want
-    if (available_abilities.abilities.empty())
-    {
-		
-		//std::cout << "empty abilities fail \n";
-        
-		return false;
-    }
-    else
-    {
-        // check to see if one of the unit's available abilities matches the build ability type
-        sc2::AbilityID MetaTypeAbility = m_bot.Data(type).buildAbility;
-
-		//std::cout << MetaTypeAbility.to_string() << " meta type ability that we are looking for \n";
-
-        for (const sc2::AvailableAbility & available_ability : available_abilities.abilities)
-        {
-			//std::cout << available_ability.ability_id << " ability id we found \n";
-            if (available_ability.ability_id == MetaTypeAbility)
-            {
-                return true;
-            }
-        }
-    }
-
-	//std::cout << "end method fail \n";
-    return false;
+    return m_abilityPredictor.canMake(producer, type);
 #else
     bool canMake = meetsReservedResources(type);
 	if (canMake)
@@ -4,6 +4,7 @@
 #include "BuildOrder.h"
 #include "BuildingManager.h"
 #include "BuildOrderQueue.h"
+#include "AbilityPredictor.h"
 #include <stdlib.h>
 #include <time.h>
 #include <queue> 
@@ -40,6 +41,7 @@ class ProductionManager
 
 	BuildingManager m_buildingManager;
 	BuildOrderQueue m_queue;
+	AbilityPredictor m_abilityPredictor;
 
 	priority_queue<priorityMetaType> metaTypePriorityQueue; 
 
@@ -28,6 +28,9 @@ void RangedManager::assignTargets(const std::vector<Unit> & targets)
         rangedUnitTargets.push_back(target);
     }
 
+    // the field towards the order position, only fetched once a unit has to walk there
+    const FlowField * toOrder = nullptr;
+
     // for each meleeUnit
     for (auto rangedUnit : rangedUnits)
     {
@@ -58,8 +61,19 @@ void RangedManager::assignTargets(const std::vector<Unit> & targets)
                 // if we're not near the order position
                 if (Util::Dist(rangedUnit, order.getPosition()) > 4)
                 {
-                    // move to it
-                    rangedUnit.move(order.getPosition());
+                    // move to it, ground units along the flow field every unit of the squad shares
+                    if (rangedUnit.isFlying())
+                    {
+                        rangedUnit.move(order.getPosition());
+                    }
+                    else
+                    {
+                        if (!toOrder)
+                        {
+                            toOrder = &m_bot.Map().getFlowField(order.getPosition());
+                        }
+                        rangedUnit.move(toOrder->getWaypoint(rangedUnit.getPosition()));
+                    }
                 }
             }
         }
@@ -0,0 +1,224 @@
+#include "SafePathCache.h"
+#include "CCBot.h"
+#include "Util.h"
+
+const int SafePathCache::BaseStepCost;
+const int SafePathCache::MaxThreatCost;
+const int SafePathCache::ThreatDivisor;
+const int SafePathCache::RefreshInterval;
+const size_t SafePathCache::MaxFields;
+const uint32_t SafePathCache::Unreachable;
+
+namespace
+{
+    const int StepX[4] = { -1, 1, 0, 0 };
+    const int StepY[4] = { 0, 0, -1, 1 };
+}
+
+SafePathCache::SafePathCache(CCBot & bot)
+    : m_bot(bot)
+{
+
+}
+
+void SafePathCache::onStart()
+{
+    m_fields.clear();
+    m_buckets.assign(BaseStepCost + MaxThreatCost + 1, std::vector<int>());
+}
+
+int SafePathCache::stepCost(int x, int y) const
+{
+    const int threat = m_bot.Influence().getValue(InfluenceLayer::GroundDPS, x, y);
+    return BaseStepCost + std::min(MaxThreatCost, std::max(0, threat) / ThreatDivisor);
+}
+
+// destinations are often building or base centers, which are not walkable, so the search starts from the closest
+// walkable tile in growing squares around it, or from the destination itself if there is none nearby
+CCTilePosition SafePathCache::getSearchStart(const CCTilePosition & destination) const
+{
+    const WalkabilityMask & walkable = m_bot.Map().getWalkabilityMask();
+    if (walkable.isWalkable(destination.x, destination.y))
+    {
+        return destination;
+    }
+
+    for (int r(1); r <= 8; ++r)
+    {
+        for (int dy(-r); dy <= r; ++dy)
+        {
+            for (int dx(-r); dx <= r; ++dx)
+            {
+                if (std::max(std::abs(dx), std::abs(dy)) == r && walkable.isWalkable(destination.x + dx, destination.y + dy))
+                {
+                    return CCTilePosition(destination.x + dx, destination.y + dy);
+                }
+            }
+        }
+    }
+
+    return destination;
+}
+
+// Dijkstra from the destination outwards, with the open list as a dial queue:
+// every step costs between BaseStepCost and BaseStepCost + MaxThreatCost, so all open tiles have a cost
+// within one ring of buckets of the cost being expanded, and the bucket for a cost is its index modulo the ring
+void SafePathCache::computeField(Field & field)
+{
+    const WalkabilityMask & walkable = m_bot.Map().getWalkabilityMask();
+    const int width = m_bot.Map().width();
+    const int height = m_bot.Map().height();
+
+    field.cost.reset(width, height, Unreachable);
+    field.threatVersion = m_bot.Influence().getVersion(InfluenceLayer::GroundDPS);
+    field.computedFrame = m_bot.GetCurrentFrame();
+
+    const CCTilePosition start = getSearchStart(field.destination);
+    if (!field.cost.isValid(start.x, start.y))
+    {
+        return;
+    }
+
+    const size_t ringSize = m_buckets.size();
+    for (auto & bucket : m_buckets)
+    {
+        bucket.clear();
+    }
+
+    field.cost(start.x, start.y) = 0;
+    m_buckets[0].push_back(start.y * width + start.x);
+    size_t open = 1;
+
+    for (uint32_t current = 0; open > 0; ++current)
+    {
+        std::vector<int> & bucket = m_buckets[current % ringSize];
+        while (!bucket.empty())
+        {
+            const int index = bucket.back();
+            bucket.pop_back();
+            open--;
+
+            const int x = index % width;
+            const int y = index / width;
+
+            // a tile can be pushed again after a cheaper cost was found, the stale entry is skipped
+            if (field.cost(x, y) != current)
+            {
+                continue;
+            }
+
+            for (int d(0); d < 4; ++d)
+            {
+                const int nx = x + StepX[d];
+                const int ny = y + StepY[d];
+                if (!walkable.isWalkable(nx, ny))
+                {
+                    continue;
+                }
+
+                const uint32_t cost = current + stepCost(nx, ny);
+                if (cost < field.cost(nx, ny))
+                {
+                    field.cost(nx, ny) = cost;
+                    m_buckets[cost % ringSize].push_back(ny * width + nx);
+                    open++;
+                }
+            }
+        }
+    }
+}
+
+const SafePathCache::Field & SafePathCache::getField(const CCTilePosition & destination)
+{
+    const int frame = m_bot.GetCurrentFrame();
+    const uint32_t threatVersion = m_bot.Influence().getVersion(InfluenceLayer::GroundDPS);
+
+    for (auto & field : m_fields)
+    {
+        if (field.destination.x != destination.x || field.destination.y != destination.y)
+        {
+            continue;
+        }
+
+        field.usedFrame = frame;
+        if (field.threatVersion != threatVersion && frame - field.computedFrame >= RefreshInterval)
+        {
+            computeField(field);
+        }
+
+        return field;
+    }
+
+    // reuse the least recently used field's buffer once the cache is full
+    Field * field = nullptr;
+    if (m_fields.size() < MaxFields)
+    {
+        m_fields.emplace_back();
+        field = &m_fields.back();
+    }
+    else
+    {
+        field = &*std::min_element(m_fields.begin(), m_fields.end(), [](const Field & a, const Field & b) { return a.usedFrame < b.usedFrame; });
+    }
+
+    field->destination = destination;
+    field->usedFrame = frame;
+    computeField(*field);
+    return *field;
+}
+
+CCPosition SafePathCache::getNextWaypoint(const CCPosition & pos, const CCPosition & destination, int lookahead)
+{
+    const Field & field = getField(Util::GetTilePosition(destination));
+    CCTilePosition tile = Util::GetTilePosition(pos);
+
+    if (!field.cost.isValid(tile.x, tile.y) || field.cost(tile.x, tile.y) == Unreachable)
+    {
+        return destination;
+    }
+
+    // walk down the cost field, each step to the neighbour closest to the destination
+    for (int step(0); step < lookahead; ++step)
+    {
+        const uint32_t here = field.cost(tile.x, tile.y);
+        if (here == 0)
+        {
+            return destination;
+        }
+
+        CCTilePosition next = tile;
+        uint32_t nextCost = here;
+        for (int d(0); d < 4; ++d)
+        {
+            const int nx = tile.x + StepX[d];
+            const int ny = tile.y + StepY[d];
+            if (field.cost.isValid(nx, ny) && field.cost(nx, ny) < nextCost)
+            {
+                nextCost = field.cost(nx, ny);
+                next = CCTilePosition(nx, ny);
+            }
+        }
+
+        if (nextCost == here)
+        {
+            break;
+        }
+
+        tile = next;
+    }
+
+    return CCPosition(tile.x + 0.5f, tile.y + 0.5f);
+}
+
+int SafePathCache::getPathCost(const CCPosition & pos, const CCPosition & destination)
+{
+    const Field & field = getField(Util::GetTilePosition(destination));
+    const CCTilePosition tile = Util::GetTilePosition(pos);
+
+    if (!field.cost.isValid(tile.x, tile.y) || field.cost(tile.x, tile.y) == Unreachable)
+    {
+        return -1;
+    }
+
+    return (int)field.cost(tile.x, tile.y);
+}
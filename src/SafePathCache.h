@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Common.h"
+#include "Grid2D.h"
+
+class CCBot;
+
+// Threat weighted paths towards a destination, shared by every unit heading there
+// a cost field holds the cheapest cost from every walkable tile to the destination, where entering a tile costs
+// a base step plus a penalty for the enemy ground DPS on it, so paths bend around danger instead of through it.
+// the field is a Dijkstra search run backwards from the destination with a dial queue: step costs are small
+// integers, so the open list is a ring of buckets indexed by cost and each tile is pushed and popped in O(1).
+// fields are memoized per destination tile and kept until the ground threat layer's version changes,
+// and even then only recomputed once they are RefreshInterval frames old, so many queries per frame stay cheap
+class SafePathCache
+{
+    struct Field
+    {
+        CCTilePosition      destination;
+        uint32_t            threatVersion;
+        int                 computedFrame;
+        int                 usedFrame;
+        Grid2D<uint32_t>    cost;
+    };
+
+    static const int        BaseStepCost    = 10;
+    static const int        MaxThreatCost   = 245;     // so a step never costs more than the ring of buckets can hold
+    static const int        ThreatDivisor   = 4;       // tenths of DPS per point of step cost
+    static const int        RefreshInterval = 8;
+    static const size_t     MaxFields       = 8;
+    static const uint32_t   Unreachable     = 0xFFFFFFFF;
+
+    CCBot &                             m_bot;
+    std::vector<Field>                  m_fields;
+    std::vector<std::vector<int>>       m_buckets;      // the dial queue, tile indices by cost modulo the ring size
+
+    int             stepCost(int x, int y) const;
+    CCTilePosition  getSearchStart(const CCTilePosition & destination) const;
+    void            computeField(Field & field);
+    const Field &   getField(const CCTilePosition & destination);
+
+public:
+
+    SafePathCache(CCBot & bot);
+
+    void        onStart();
+
+    // the point to move to next on the safest path from pos to destination, lookahead tiles down the path
+    // returns the destination itself when it is that close, or when pos can't reach it on the ground
+    CCPosition  getNextWaypoint(const CCPosition & pos, const CCPosition & destination, int lookahead = 6);
+
+    // the threat weighted cost from pos to destination in tenths of a clear tile, -1 if it can't be reached
+    int         getPathCost(const CCPosition & pos, const CCPosition & destination);
+};
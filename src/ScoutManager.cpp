@@ -63,7 +63,7 @@ void ScoutManager::moveScouts()
     // if we know where the enemy region is and where our scout is
     if (enemyBaseLocation)
     {
-        int scoutDistanceToEnemy = m_bot.Map().getGroundDistance(workerScout.getPosition(), enemyBaseLocation->getPosition());
+        int scoutDistanceToEnemy = enemyBaseLocation->getGroundDistance(workerScout.getPosition());
         bool scoutInRangeOfenemy = enemyBaseLocation->containsPosition(workerScout.getPosition());
 
         // we only care if the scout is under attack within the enemy region
@@ -97,14 +97,14 @@ void ScoutManager::moveScouts()
                 else
                 {
                     m_scoutStatus = "Moving to enemy base location";
-                    m_scoutUnit.move(enemyBaseLocation->getPosition());
+                    moveSafely(enemyBaseLocation->getPosition());
                 }
             }
             // if the worker scout is under attack
             else
             {
                 m_scoutStatus = "Under attack inside, fleeing";
-                m_scoutUnit.move(getFleePosition());
+                moveSafely(getFleePosition());
             }
         }
         // if the scout is not in the enemy region
@@ -112,14 +112,14 @@ void ScoutManager::moveScouts()
         {
             m_scoutStatus = "Under attack outside, fleeing";
 
-            m_scoutUnit.move(getFleePosition());
+            moveSafely(getFleePosition());
         }
         else
         {
             m_scoutStatus = "Enemy region known, going there";
 
             // move to the enemy region
-            m_scoutUnit.move(enemyBaseLocation->getPosition());
+            moveSafely(enemyBaseLocation->getPosition());
         }
 
     }
@@ -129,13 +129,17 @@ void ScoutManager::moveScouts()
     {
         m_scoutStatus = "Enemy base unknown, exploring";
 
-        for (const BaseLocation * startLocation : m_bot.Bases().getStartingBaseLocations())
+        // visit the start locations closest to our own main first
+        const BaseLocation * myBaseLocation = m_bot.Bases().getPlayerStartingBaseLocation(Players::Self);
+        const std::vector<const BaseLocation *> & basesByDistance = myBaseLocation ? m_bot.Bases().getBaseDistances().getBasesByDistance(myBaseLocation)
+                                                                                   : m_bot.Bases().getStartingBaseLocations();
+
+        for (const BaseLocation * startLocation : basesByDistance)
         {
             // if we haven't explored it yet then scout it out
-            // TODO: this is where we could change the order of the base scouting, since right now it's iterator order
-            if (!m_bot.Map().isExplored(startLocation->getPosition()))
+            if (startLocation->isStartLocation() && !m_bot.Map().isExplored(startLocation->getPosition()))
             {
-                m_scoutUnit.move(startLocation->getPosition());
+                moveSafely(startLocation->getPosition());
                 return;
             }
         }
@@ -181,6 +185,12 @@ bool ScoutManager::enemyWorkerInRadiusOf(const CCPosition & pos) const
     return false;
 }
 
+// heads for the position along the path that keeps out of enemy fire the most, rather than in a straight line
+void ScoutManager::moveSafely(const CCPosition & pos)
+{
+    m_scoutUnit.move(m_bot.SafePaths().getNextWaypoint(m_scoutUnit.getPosition(), pos));
+}
+
 CCPosition ScoutManager::getFleePosition() const
 {
     // TODO: make this follow the perimeter of the enemy base again, but for now just use home base as flee direction
@@ -17,6 +17,7 @@ class ScoutManager
 
     bool            enemyWorkerInRadiusOf(const CCPosition & pos) const;
     CCPosition      getFleePosition() const;
+    void            moveSafely(const CCPosition & pos);
     Unit            closestEnemyWorkerTo(const CCPosition & pos) const;
     void            moveScouts();
     void            drawScoutInformation();
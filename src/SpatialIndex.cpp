@@ -0,0 +1,271 @@
+#include "SpatialIndex.h"
+#include <algorithm>
+#include <cmath>
+
+const int SpatialIndex::CellSize;
+
+SpatialIndex::SpatialIndex()
+    : m_units   (nullptr)
+    , m_minX    (0)
+    , m_minY    (0)
+    , m_cellsX  (0)
+    , m_cellsY  (0)
+{
+
+}
+
+int SpatialIndex::getCellX(float x) const
+{
+    const int cx = (int)std::floor((x - m_minX) / CellSize);
+    return std::max(0, std::min(m_cellsX - 1, cx));
+}
+
+int SpatialIndex::getCellY(float y) const
+{
+    const int cy = (int)std::floor((y - m_minY) / CellSize);
+    return std::max(0, std::min(m_cellsY - 1, cy));
+}
+
+void SpatialIndex::build(const UnitSnapshot & snapshot, const std::vector<Unit> & units)
+{
+    BOT_ASSERT(snapshot.size() == units.size(), "Spatial index needs one unit handle per snapshot slot");
+
+    m_units = &units;
+
+    const std::vector<CCPosition> & positions = snapshot.getPositions();
+    const std::vector<uint8_t> & players = snapshot.getPlayers();
+    const std::vector<uint8_t> & flags = snapshot.getFlags();
+    const size_t numUnits = positions.size();
+
+    // the grid covers the bounding box of the units, so it needs nothing from the map
+    m_minX = numUnits > 0 ? (float)positions[0].x : 0;
+    m_minY = numUnits > 0 ? (float)positions[0].y : 0;
+    float maxX = m_minX;
+    float maxY = m_minY;
+
+    for (const auto & pos : positions)
+    {
+        m_minX = std::min(m_minX, (float)pos.x);
+        m_minY = std::min(m_minY, (float)pos.y);
+        maxX   = std::max(maxX, (float)pos.x);
+        maxY   = std::max(maxY, (float)pos.y);
+    }
+
+    m_cellsX = (int)((maxX - m_minX) / CellSize) + 1;
+    m_cellsY = (int)((maxY - m_minY) / CellSize) + 1;
+    const size_t numCells = (size_t)m_cellsX * m_cellsY;
+
+    for (auto & playerLayers : m_layers)
+    {
+        for (auto & layer : playerLayers)
+        {
+            layer.cellStart.assign(numCells + 1, 0);
+            layer.entries.clear();
+        }
+    }
+
+    // counting sort by cell: count, prefix sum, then scatter
+    std::vector<int> unitCell(numUnits, -1);
+    for (size_t i(0); i < numUnits; ++i)
+    {
+        if (players[i] >= Players::Size) { continue; }
+
+        unitCell[i] = getCellY(positions[i].y) * m_cellsX + getCellX(positions[i].x);
+        m_layers[players[i]][(flags[i] & UnitFlags::Flying) ? 1 : 0].cellStart[unitCell[i] + 1]++;
+    }
+
+    for (auto & playerLayers : m_layers)
+    {
+        for (auto & layer : playerLayers)
+        {
+            for (size_t c(0); c < numCells; ++c)
+            {
+                layer.cellStart[c + 1] += layer.cellStart[c];
+            }
+
+            layer.entries.resize(layer.cellStart[numCells]);
+        }
+    }
+
+    std::vector<int> fill[Players::Size][2];
+    for (int p(0); p < Players::Size; ++p)
+    {
+        for (int l(0); l < 2; ++l)
+        {
+            fill[p][l].assign(m_layers[p][l].cellStart.begin(), m_layers[p][l].cellStart.end() - 1);
+        }
+    }
+
+    for (size_t i(0); i < numUnits; ++i)
+    {
+        if (unitCell[i] < 0) { continue; }
+
+        const int player = players[i];
+        const int air = (flags[i] & UnitFlags::Flying) ? 1 : 0;
+
+        Entry & entry = m_layers[player][air].entries[fill[player][air][unitCell[i]]++];
+        entry.x    = positions[i].x;
+        entry.y    = positions[i].y;
+        entry.unit = (int)i;
+    }
+}
+
+template <class F>
+void SpatialIndex::forEachInCells(CCPlayer player, int layers, int cx1, int cy1, int cx2, int cy2, F && visit) const
+{
+    for (int l(0); l < 2; ++l)
+    {
+        if (!(layers & (l == 0 ? SpatialLayers::Ground : SpatialLayers::Air)))
+        {
+            continue;
+        }
+
+        const Layer & layer = m_layers[player][l];
+        if (layer.entries.empty())
+        {
+            continue;
+        }
+
+        for (int cy = cy1; cy <= cy2; ++cy)
+        {
+            // cells in a row are contiguous, so the whole span of the row is one range of entries
+            const int begin = layer.cellStart[cy * m_cellsX + cx1];
+            const int end   = layer.cellStart[cy * m_cellsX + cx2 + 1];
+            for (int e = begin; e < end; ++e)
+            {
+                visit(layer.entries[e]);
+            }
+        }
+    }
+}
+
+template <class F>
+void SpatialIndex::forEachInRadius(const CCPosition & center, float radius, CCPlayer player, int layers, F && visit) const
+{
+    if (!m_units || player >= Players::Size || m_cellsX == 0)
+    {
+        return;
+    }
+
+    const float radiusSq = radius * radius;
+    forEachInCells(player, layers, getCellX(center.x - radius), getCellY(center.y - radius), getCellX(center.x + radius), getCellY(center.y + radius),
+        [&](const Entry & entry)
+    {
+        const float dx = entry.x - center.x;
+        const float dy = entry.y - center.y;
+        if (dx * dx + dy * dy < radiusSq)
+        {
+            visit(entry);
+        }
+    });
+}
+
+void SpatialIndex::queryRadius(const CCPosition & center, float radius, CCPlayer player, std::vector<Unit> & units, int layers, const UnitFilter & filter) const
+{
+    forEachInRadius(center, radius, player, layers, [&](const Entry & entry)
+    {
+        const Unit & unit = (*m_units)[entry.unit];
+        if (!filter || filter(unit))
+        {
+            units.push_back(unit);
+        }
+    });
+}
+
+size_t SpatialIndex::countInRadius(const CCPosition & center, float radius, CCPlayer player, int layers, const UnitFilter & filter) const
+{
+    size_t count = 0;
+    forEachInRadius(center, radius, player, layers, [&](const Entry & entry)
+    {
+        if (!filter || filter((*m_units)[entry.unit]))
+        {
+            count++;
+        }
+    });
+
+    return count;
+}
+
+std::vector<Unit> SpatialIndex::nearest(const CCPosition & center, size_t k, CCPlayer player, int layers, const UnitFilter & filter, float maxRadius) const
+{
+    std::vector<Unit> result;
+    if (!m_units || k == 0 || player >= Players::Size || m_cellsX == 0)
+    {
+        return result;
+    }
+
+    // max heap of the best k candidates found so far, keyed on squared distance
+    std::vector<std::pair<float, int>> best;
+    const float maxRadiusSq = maxRadius < std::sqrt(std::numeric_limits<float>::max()) ? maxRadius * maxRadius : std::numeric_limits<float>::max();
+
+    const int ccx = getCellX(center.x);
+    const int ccy = getCellY(center.y);
+    const int maxRing = std::max(std::max(ccx, m_cellsX - 1 - ccx), std::max(ccy, m_cellsY - 1 - ccy));
+
+    auto consider = [&](const Entry & entry)
+    {
+        const float dx = entry.x - center.x;
+        const float dy = entry.y - center.y;
+        const float distSq = dx * dx + dy * dy;
+        if (distSq > maxRadiusSq || (best.size() == k && distSq >= best.front().first))
+        {
+            return;
+        }
+
+        if (filter && !filter((*m_units)[entry.unit]))
+        {
+            return;
+        }
+
+        best.push_back(std::make_pair(distSq, entry.unit));
+        std::push_heap(best.begin(), best.end());
+        if (best.size() > k)
+        {
+            std::pop_heap(best.begin(), best.end());
+            best.pop_back();
+        }
+    };
+
+    // search square rings of cells outwards from the center cell
+    for (int ring = 0; ring <= maxRing; ++ring)
+    {
+        const int x1 = ccx - ring, x2 = ccx + ring;
+        const int y1 = ccy - ring, y2 = ccy + ring;
+
+        if (ring == 0)
+        {
+            forEachInCells(player, layers, ccx, ccy, ccx, ccy, consider);
+        }
+        else
+        {
+            // top and bottom rows of the ring, then the left and right columns between them
+            const int rx1 = std::max(0, x1);
+            const int rx2 = std::min(m_cellsX - 1, x2);
+            if (y1 >= 0)        { forEachInCells(player, layers, rx1, y1, rx2, y1, consider); }
+            if (y2 < m_cellsY)  { forEachInCells(player, layers, rx1, y2, rx2, y2, consider); }
+
+            const int cy1 = std::max(0, y1 + 1);
+            const int cy2 = std::min(m_cellsY - 1, y2 - 1);
+            if (cy1 <= cy2)
+            {
+                if (x1 >= 0)        { forEachInCells(player, layers, x1, cy1, x1, cy2, consider); }
+                if (x2 < m_cellsX)  { forEachInCells(player, layers, x2, cy1, x2, cy2, consider); }
+            }
+        }
+
+        // anything in the next ring is at least this far from the center
+        const float nextRingDist = (float)ring * CellSize;
+        if (nextRingDist * nextRingDist > maxRadiusSq || (best.size() == k && nextRingDist * nextRingDist >= best.front().first))
+        {
+            break;
+        }
+    }
+
+    std::sort_heap(best.begin(), best.end());
+    for (auto & candidate : best)
+    {
+        result.push_back((*m_units)[candidate.second]);
+    }
+
+    return result;
+}
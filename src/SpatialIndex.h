@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Common.h"
+#include "Unit.h"
+#include "UnitSnapshot.h"
+#include <functional>
+#include <limits>
+
+namespace SpatialLayers
+{
+    enum { Ground = 1, Air = 2, All = 3 };
+}
+
+// Uniform bucket grid over every unit visible this frame, rebuilt from CCBot's unit snapshot in setUnits
+// units are split into separate grids by player and by ground / air, each stored as one packed array
+// sorted by cell, so a radius query only touches the cells overlapping the query circle
+// the returned units are copies of CCBot's units, and the index is only valid until the next frame
+class SpatialIndex
+{
+public:
+
+    typedef std::function<bool(const Unit &)> UnitFilter;
+
+    static const int CellSize = 8;
+
+private:
+
+    struct Entry
+    {
+        float   x;
+        float   y;
+        int     unit;       // index into m_units
+    };
+
+    struct Layer
+    {
+        std::vector<int>    cellStart;  // entries of cell c are [cellStart[c], cellStart[c+1])
+        std::vector<Entry>  entries;
+    };
+
+    const std::vector<Unit> *   m_units;    // one handle per snapshot slot
+    float                       m_minX;
+    float                       m_minY;
+    int                         m_cellsX;
+    int                         m_cellsY;
+    Layer                       m_layers[Players::Size][2];
+
+    int     getCellX(float x) const;
+    int     getCellY(float y) const;
+
+    template <class F>
+    void    forEachInRadius(const CCPosition & center, float radius, CCPlayer player, int layers, F && visit) const;
+
+    template <class F>
+    void    forEachInCells(CCPlayer player, int layers, int cx1, int cy1, int cx2, int cy2, F && visit) const;
+
+public:
+
+    SpatialIndex();
+
+    void    build(const UnitSnapshot & snapshot, const std::vector<Unit> & units);
+
+    // every unit of the player within radius of center, optionally filtered
+    void    queryRadius(const CCPosition & center, float radius, CCPlayer player, std::vector<Unit> & units,
+                        int layers = SpatialLayers::All, const UnitFilter & filter = UnitFilter()) const;
+
+    size_t  countInRadius(const CCPosition & center, float radius, CCPlayer player,
+                          int layers = SpatialLayers::All, const UnitFilter & filter = UnitFilter()) const;
+
+    // the k units of the player closest to center, closest first, searching no further than maxRadius
+    std::vector<Unit> nearest(const CCPosition & center, size_t k, CCPlayer player, int layers = SpatialLayers::All,
+                              const UnitFilter & filter = UnitFilter(), float maxRadius = std::numeric_limits<float>::max()) const;
+};
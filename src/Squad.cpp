@@ -69,28 +69,13 @@ void Squad::setPriority(const size_t & priority)
     m_priority = priority;
 }
 
+// dead units are removed by SquadData when they are destroyed, and units only join squads once completed
 void Squad::updateUnits()
 {
-    setAllUnits();
     setNearEnemyUnits();
     addUnitsToMicroManagers();
 }
 
-void Squad::setAllUnits()
-{
-    // clean up the _units vector just in case one of them died
-    std::set<Unit> goodUnits;
-    for (auto unit : m_units)
-    {
-        if (!unit.isValid()) { continue; }
-        if (unit.isBeingConstructed()) { continue; }
-        
-        goodUnits.insert(unit);
-    }
-
-    m_units = goodUnits;
-}
-
 void Squad::setNearEnemyUnits()
 {
     m_nearEnemy.clear();
@@ -178,15 +163,7 @@ bool Squad::isUnitNearEnemy(const Unit & unit) const
 {
     BOT_ASSERT(unit.isValid(), "null unit in squad");
 
-    for (auto & u : m_bot.GetUnits())
-    {
-        if ((u.getPlayer() == Players::Enemy) && (Util::Dist(unit, u) < 20))
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return m_bot.Spatial().countInRadius(unit.getPosition(), 20, Players::Enemy) > 0;
 }
 
 CCPosition Squad::calcCenter() const
@@ -239,13 +216,14 @@ Unit Squad::unitClosestToEnemy() const
 {
     Unit closest;
     float closestDist = std::numeric_limits<float>::max();
+    const FlowField & toOrder = m_bot.Map().getFlowField(m_order.getPosition());
 
     for (auto & unit : m_units)
     {
         BOT_ASSERT(unit.isValid(), "null unit");
 
         // the distance to the order position
-        int dist = m_bot.Map().getGroundDistance(unit.getPosition(), m_order.getPosition());
+        int dist = toOrder.getDistance(unit.getPosition());
 
         if (dist != -1 && (!closest.isValid() || dist < closestDist))
         {
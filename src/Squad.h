@@ -4,6 +4,7 @@
 #include "MeleeManager.h"
 #include "RangedManager.h"
 #include "SquadOrder.h"
+#include "FlatUnitMap.h"
 
 class CCBot;
 
@@ -22,14 +23,13 @@ class Squad
     MeleeManager        m_meleeManager;
     RangedManager       m_rangedManager;
 
-    std::map<Unit, bool> m_nearEnemy;
+    FlatUnitMap<Unit, bool> m_nearEnemy;
 
     Unit unitClosestToEnemy() const;
 
     void updateUnits();
     void addUnitsToMicroManagers();
     void setNearEnemyUnits();
-    void setAllUnits();
 
     bool isUnitNearEnemy(const Unit & unit) const;
     bool needsToRegroup() const;
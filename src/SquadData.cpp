@@ -164,6 +164,16 @@ Squad * SquadData::getUnitSquad(const Unit & unit)
     return nullptr;
 }
 
+void SquadData::onUnitDestroy(const Unit & unit)
+{
+    Squad * squad = getUnitSquad(unit);
+
+    if (squad)
+    {
+        squad->removeUnit(unit);
+    }
+}
+
 void SquadData::assignUnitToSquad(const Unit & unit, Squad & squad)
 {
     BOT_ASSERT(canAssignUnitToSquad(unit, squad), "We shouldn't be re-assigning this unit!");
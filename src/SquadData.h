@@ -25,6 +25,7 @@ public:
     void            addSquad(const std::string & squadName, const Squad & squad);
     void            removeSquad(const std::string & squadName);
     void            drawSquadInformation();
+    void            onUnitDestroy(const Unit & unit);
 
 
     bool            squadExists(const std::string & squadName);
@@ -0,0 +1,43 @@
+#include "StampMask.h"
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+    // every mask packed into one buffer, mask r starts at r * r since masks 0 to r - 1 hold 1 + 3 + ... + (2r - 1) rows
+    std::vector<int16_t> BuildMasks()
+    {
+        std::vector<int16_t> masks((StampMask::MaxRadius + 1) * (StampMask::MaxRadius + 1));
+
+        for (int radius(0); radius <= StampMask::MaxRadius; ++radius)
+        {
+            int16_t * mask = masks.data() + radius * radius;
+            for (int dy(-radius); dy <= radius; ++dy)
+            {
+                // the widest row span whose tiles all lie within the circle
+                int halfWidth = 0;
+                while ((halfWidth + 1) * (halfWidth + 1) + dy * dy <= radius * radius)
+                {
+                    ++halfWidth;
+                }
+
+                mask[dy + radius] = (int16_t)halfWidth;
+            }
+        }
+
+        return masks;
+    }
+}
+
+int StampMask::ClampRadius(int radius)
+{
+    return std::max(0, std::min(MaxRadius, radius));
+}
+
+const int16_t * StampMask::HalfWidths(int radius)
+{
+    static const std::vector<int16_t> masks = BuildMasks();
+
+    radius = ClampRadius(radius);
+    return masks.data() + radius * radius;
+}
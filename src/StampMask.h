@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+// Run-length masks for the circles units stamp onto the influence map
+// the mask of radius r holds, for every row offset dy in [-r, r], the half width of the circle on that row,
+// so stamping a circle is one clipped row span per row with no per tile test of whether the tile is inside it.
+// an annulus is stamped as the outer circle at the ring's value plus the inner circle at the difference
+namespace StampMask
+{
+    // covers the longest weapon, sight and detection ranges in the game plus unit radius and threat margin
+    const int MaxRadius = 32;
+
+    // half widths of the circle of the given radius indexed by dy + radius, larger radii are clamped to MaxRadius
+    const int16_t * HalfWidths(int radius);
+
+    int ClampRadius(int radius);
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Grid2D.h"
+#include <algorithm>
+
+// Integral image over a Grid2D layer, so the sum over any rectangle of tiles is four loads
+// entry (x, y) holds the sum of every tile below and to the left of it, with an extra zero row and column
+// the table is built lazily: the owner of the source grid calls invalidate() whenever it writes to it,
+// and the next query rebuilds the table from the grid with the given per tile value
+class SummedAreaTable
+{
+    Grid2D<int> m_sums;
+    bool        m_dirty;
+
+public:
+
+    SummedAreaTable()
+        : m_dirty(true)
+    {
+    }
+
+    void invalidate()
+    {
+        m_dirty = true;
+    }
+
+    bool isDirty() const
+    {
+        return m_dirty;
+    }
+
+    // value(x, y) is the contribution of tile (x, y), for example 1 for an unbuildable tile
+    template <class ValueFunc>
+    void build(int width, int height, ValueFunc value)
+    {
+        if (m_sums.width() != width + 1 || m_sums.height() != height + 1)
+        {
+            m_sums.reset(width + 1, height + 1, 0);
+        }
+
+        for (int y(0); y < height; ++y)
+        {
+            int rowSum = 0;
+            const int * below = m_sums.row(y);
+            int * sums = m_sums.row(y + 1);
+            for (int x(0); x < width; ++x)
+            {
+                rowSum += value(x, y);
+                sums[x + 1] = below[x + 1] + rowSum;
+            }
+        }
+
+        m_dirty = false;
+    }
+
+    // sum over the tiles [x, x + width) x [y, y + height), tiles off the grid count as zero
+    int sum(int x, int y, int width, int height) const
+    {
+        const int x1 = std::max(0, x);
+        const int y1 = std::max(0, y);
+        const int x2 = std::min(m_sums.width() - 1, x + width);
+        const int y2 = std::min(m_sums.height() - 1, y + height);
+
+        if (x1 >= x2 || y1 >= y2)
+        {
+            return 0;
+        }
+
+        return m_sums(x2, y2) - m_sums(x1, y2) - m_sums(x2, y1) + m_sums(x1, y1);
+    }
+};
@@ -6,6 +6,8 @@
 
 TechTree::TechTree(CCBot & bot)
     : m_bot(bot)
+    , m_unitTypeData(1)
+    , m_upgradeData(1)
 {
 
 }
@@ -14,265 +16,365 @@ void TechTree::onStart()
 {
     initUnitTypeData();
     initUpgradeData();
-    outputJSON("TechTree.json");
 }
 
 
 #ifdef SC2API
+namespace
+{
+    // longest lists in the tables below, unused list entries are left as INVALID
+    const size_t MaxProducers        = 3;
+    const size_t MaxRequiredUnits    = 5;
+    const size_t MaxRequiredUpgrades = 1;
+
+    // one row of the static tech tree, the same fields as TypeData with the lists stored inline
+    template <class ID>
+    struct TechTreeEntry
+    {
+        ID                  type;
+        sc2::Race           race;
+        int                 mineralCost;
+        int                 gasCost;
+        int                 supplyCost;
+        int                 buildTime;
+        bool                isUnit;
+        bool                isBuilding;
+        bool                isWorker;
+        bool                isRefinery;
+        bool                isSupplyProvider;
+        bool                isResourceDepot;
+        bool                isAddon;
+        sc2::ABILITY_ID     buildAbility;
+        sc2::ABILITY_ID     warpAbility;
+        sc2::UNIT_TYPEID    whatBuilds[MaxProducers];
+        sc2::UNIT_TYPEID    requiredUnits[MaxRequiredUnits];
+        sc2::UPGRADE_ID     requiredUpgrades[MaxRequiredUpgrades];
+    };
+
+    // types that share all of their data with another type
+    struct TechTreeAlias
+    {
+        sc2::UNIT_TYPEID    type;
+        sc2::UNIT_TYPEID    sameAs;
+    };
+
+    constexpr TechTreeEntry<sc2::UNIT_TYPEID> UnitTypeTable[] =
+    {
+        //                                               m    g    s    t  unit   bld    wrk    rfn    sup   hall    add
+        // Protoss Buildings
+        { sc2::UNIT_TYPEID::PROTOSS_PYLONOVERCHARGED,  sc2::Race::Protoss,   0,   0,   0,   0,  true,  true, false, false,  true, false, false, sc2::ABILITY_ID::EFFECT_PHOTONOVERCHARGE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_MOTHERSHIPCORE, sc2::UNIT_TYPEID::PROTOSS_PYLON }, {}, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_PYLON,             sc2::Race::Protoss,   0,   0,   0,   0,  true,  true, false, false,  true, false, false, sc2::ABILITY_ID::BUILD_PYLON, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_PROBE }, {}, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_NEXUS,             sc2::Race::Protoss,   0,   0,   0,   0,  true,  true, false, false, false,  true, false, sc2::ABILITY_ID::BUILD_NEXUS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_PROBE }, {}, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_ASSIMILATOR,       sc2::Race::Protoss,   0,   0,   0,   0,  true,  true, false,  true, false, false, false, sc2::ABILITY_ID::BUILD_ASSIMILATOR, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_PROBE }, {}, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE,   sc2::Race::Protoss,   0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_CYBERNETICSCORE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_PROBE }, { sc2::UNIT_TYPEID::PROTOSS_GATEWAY, sc2::UNIT_TYPEID::PROTOSS_WARPGATE }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_DARKSHRINE,        sc2::Race::Protoss,   0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_DARKSHRINE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_PROBE }, { sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON,       sc2::Race::Protoss,   0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_FLEETBEACON, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_PROBE }, { sc2::UNIT_TYPEID::PROTOSS_STARGATE }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_FORGE,             sc2::Race::Protoss,   0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_FORGE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_PROBE }, { sc2::UNIT_TYPEID::PROTOSS_NEXUS }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_GATEWAY,           sc2::Race::Protoss,   0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_GATEWAY, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_PROBE }, { sc2::UNIT_TYPEID::PROTOSS_NEXUS }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_STARGATE,          sc2::Race::Protoss,   0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_STARGATE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_PROBE }, { sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_PHOTONCANNON,      sc2::Race::Protoss,   0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_PHOTONCANNON, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_PROBE }, { sc2::UNIT_TYPEID::PROTOSS_FORGE }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_ROBOTICSBAY,       sc2::Race::Protoss,   0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_ROBOTICSBAY, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_PROBE }, { sc2::UNIT_TYPEID::PROTOSS_ROBOTICSFACILITY }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_ROBOTICSFACILITY,  sc2::Race::Protoss,   0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_ROBOTICSFACILITY, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_PROBE }, { sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_TEMPLARARCHIVE,    sc2::Race::Protoss,   0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_TEMPLARARCHIVE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_PROBE }, { sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL,   sc2::Race::Protoss,   0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_TWILIGHTCOUNCIL, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_PROBE }, { sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_WARPGATE,          sc2::Race::Protoss,   0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::MORPH_WARPGATE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_GATEWAY }, {}, { sc2::UPGRADE_ID::WARPGATERESEARCH } },
+
+        // Protoss Units
+        { sc2::UNIT_TYPEID::PROTOSS_PROBE,             sc2::Race::Protoss,   0,   0,   1,   0,  true, false,  true, false, false, false, false, sc2::ABILITY_ID::TRAIN_PROBE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_NEXUS }, {}, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_MOTHERSHIPCORE,    sc2::Race::Protoss,   0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_MOTHERSHIPCORE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_NEXUS }, {}, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_ZEALOT,            sc2::Race::Protoss,   0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_ZEALOT, sc2::ABILITY_ID::TRAINWARP_ZEALOT, { sc2::UNIT_TYPEID::PROTOSS_GATEWAY }, {}, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_SENTRY,            sc2::Race::Protoss,   0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_SENTRY, sc2::ABILITY_ID::TRAINWARP_SENTRY, { sc2::UNIT_TYPEID::PROTOSS_GATEWAY }, { sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_STALKER,           sc2::Race::Protoss,   0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_STALKER, sc2::ABILITY_ID::TRAINWARP_STALKER, { sc2::UNIT_TYPEID::PROTOSS_GATEWAY }, { sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_HIGHTEMPLAR,       sc2::Race::Protoss,   0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_HIGHTEMPLAR, sc2::ABILITY_ID::TRAINWARP_HIGHTEMPLAR, { sc2::UNIT_TYPEID::PROTOSS_GATEWAY }, { sc2::UNIT_TYPEID::PROTOSS_TEMPLARARCHIVE }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_DARKTEMPLAR,       sc2::Race::Protoss,   0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_DARKTEMPLAR, sc2::ABILITY_ID::TRAINWARP_DARKTEMPLAR, { sc2::UNIT_TYPEID::PROTOSS_GATEWAY }, { sc2::UNIT_TYPEID::PROTOSS_DARKSHRINE }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_ADEPT,             sc2::Race::Protoss,   0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_ADEPT, sc2::ABILITY_ID::TRAINWARP_ADEPT, { sc2::UNIT_TYPEID::PROTOSS_GATEWAY }, { sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_COLOSSUS,          sc2::Race::Protoss,   0,   0,   6,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_COLOSSUS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_ROBOTICSFACILITY }, { sc2::UNIT_TYPEID::PROTOSS_ROBOTICSBAY }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_DISRUPTOR,         sc2::Race::Protoss,   0,   0,   3,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_DISRUPTOR, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_ROBOTICSFACILITY }, { sc2::UNIT_TYPEID::PROTOSS_ROBOTICSBAY }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_WARPPRISM,         sc2::Race::Protoss,   0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_WARPPRISM, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_ROBOTICSFACILITY }, {}, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_OBSERVER,          sc2::Race::Protoss,   0,   0,   1,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_OBSERVER, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_ROBOTICSFACILITY }, {}, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_IMMORTAL,          sc2::Race::Protoss,   0,   0,   4,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_IMMORTAL, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_ROBOTICSFACILITY }, {}, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_CARRIER,           sc2::Race::Protoss,   0,   0,   6,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_CARRIER, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_STARGATE }, { sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_ORACLE,            sc2::Race::Protoss,   0,   0,   3,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_ORACLE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_STARGATE }, {}, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_PHOENIX,           sc2::Race::Protoss,   0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_PHOENIX, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_STARGATE }, {}, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_VOIDRAY,           sc2::Race::Protoss,   0,   0,   4,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_VOIDRAY, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_STARGATE }, {}, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_TEMPEST,           sc2::Race::Protoss,   0,   0,   4,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_TEMPEST, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_STARGATE }, { sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON }, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_INTERCEPTOR,       sc2::Race::Protoss,   0,   0,   0,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::BUILD_INTERCEPTORS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_CARRIER }, {}, {} },
+        { sc2::UNIT_TYPEID::PROTOSS_ORACLESTASISTRAP,  sc2::Race::Protoss,   0,   0,   0,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::BUILD_STASISTRAP, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_ORACLE }, {}, {} },
+
+        // Terran Buildings
+        { sc2::UNIT_TYPEID::TERRAN_COMMANDCENTER,      sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false,  true, false, sc2::ABILITY_ID::BUILD_COMMANDCENTER, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_SCV }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOT,        sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false,  true, false, false, sc2::ABILITY_ID::BUILD_SUPPLYDEPOT, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_SCV }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_REFINERY,           sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false,  true, false, false, false, sc2::ABILITY_ID::BUILD_REFINERY, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_SCV }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_ARMORY,             sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_ARMORY, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_SCV }, { sc2::UNIT_TYPEID::TERRAN_FACTORY, sc2::UNIT_TYPEID::TERRAN_FACTORYFLYING }, {} },
+        { sc2::UNIT_TYPEID::TERRAN_BARRACKS,           sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_BARRACKS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_SCV }, { sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOT, sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOTLOWERED }, {} },
+        { sc2::UNIT_TYPEID::TERRAN_SENSORTOWER,        sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_SENSORTOWER, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_SCV }, { sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY }, {} },
+        { sc2::UNIT_TYPEID::TERRAN_FACTORY,            sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_FACTORY, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_SCV }, { sc2::UNIT_TYPEID::TERRAN_BARRACKS, sc2::UNIT_TYPEID::TERRAN_BARRACKSFLYING }, {} },
+        { sc2::UNIT_TYPEID::TERRAN_FUSIONCORE,         sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_FUSIONCORE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_SCV }, { sc2::UNIT_TYPEID::TERRAN_STARPORT, sc2::UNIT_TYPEID::TERRAN_STARPORTFLYING }, {} },
+        { sc2::UNIT_TYPEID::TERRAN_STARPORT,           sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_STARPORT, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_SCV }, { sc2::UNIT_TYPEID::TERRAN_FACTORY, sc2::UNIT_TYPEID::TERRAN_FACTORYFLYING }, {} },
+        { sc2::UNIT_TYPEID::TERRAN_GHOSTACADEMY,       sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_GHOSTACADEMY, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_SCV }, { sc2::UNIT_TYPEID::TERRAN_BARRACKS, sc2::UNIT_TYPEID::TERRAN_BARRACKSFLYING }, {} },
+        { sc2::UNIT_TYPEID::TERRAN_BUNKER,             sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_BUNKER, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_SCV }, { sc2::UNIT_TYPEID::TERRAN_BARRACKS, sc2::UNIT_TYPEID::TERRAN_BARRACKSFLYING }, {} },
+        { sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY,     sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_ENGINEERINGBAY, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_SCV }, { sc2::UNIT_TYPEID::TERRAN_COMMANDCENTER, sc2::UNIT_TYPEID::TERRAN_COMMANDCENTERFLYING, sc2::UNIT_TYPEID::TERRAN_PLANETARYFORTRESS, sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMAND, sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMANDFLYING }, {} },
+        { sc2::UNIT_TYPEID::TERRAN_MISSILETURRET,      sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_MISSILETURRET, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_SCV }, { sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY }, {} },
+        { sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMAND,     sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::MORPH_ORBITALCOMMAND, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_COMMANDCENTER }, { sc2::UNIT_TYPEID::TERRAN_BARRACKS }, {} },
+        { sc2::UNIT_TYPEID::TERRAN_PLANETARYFORTRESS,  sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::MORPH_PLANETARYFORTRESS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_COMMANDCENTER }, { sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY }, {} },
+
+        // Terran Addons
+        { sc2::UNIT_TYPEID::TERRAN_BARRACKSREACTOR,    sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false,  true, sc2::ABILITY_ID::BUILD_REACTOR, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_BARRACKS }, {}, {} }, // ability id changed from build_reactor_barracks
+        { sc2::UNIT_TYPEID::TERRAN_BARRACKSTECHLAB,    sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false,  true, sc2::ABILITY_ID::BUILD_TECHLAB, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_BARRACKS }, {}, {} }, // same below..
+        { sc2::UNIT_TYPEID::TERRAN_FACTORYREACTOR,     sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false,  true, sc2::ABILITY_ID::BUILD_REACTOR, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_FACTORY }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_FACTORYTECHLAB,     sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false,  true, sc2::ABILITY_ID::BUILD_TECHLAB, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_FACTORY }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_STARPORTREACTOR,    sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false,  true, sc2::ABILITY_ID::BUILD_REACTOR, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_STARPORT }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB,    sc2::Race::Terran,    0,   0,   0,   0,  true,  true, false, false, false, false,  true, sc2::ABILITY_ID::BUILD_TECHLAB, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_STARPORT }, {}, {} },
+
+        // Terran Units
+        { sc2::UNIT_TYPEID::TERRAN_SCV,                sc2::Race::Terran,    0,   0,   1,   0,  true, false,  true, false, false, false, false, sc2::ABILITY_ID::TRAIN_SCV, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_COMMANDCENTER, sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMAND, sc2::UNIT_TYPEID::TERRAN_PLANETARYFORTRESS }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_GHOST,              sc2::Race::Terran,    0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_GHOST, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_BARRACKS }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_MARAUDER,           sc2::Race::Terran,    0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_MARAUDER, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_BARRACKS }, { sc2::UNIT_TYPEID::TERRAN_TECHLAB, sc2::UNIT_TYPEID::TERRAN_BARRACKSTECHLAB, sc2::UNIT_TYPEID::TERRAN_FACTORYTECHLAB, sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB }, {} },
+        { sc2::UNIT_TYPEID::TERRAN_MARINE,             sc2::Race::Terran,    0,   0,   1,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_MARINE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_BARRACKS }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_REAPER,             sc2::Race::Terran,    0,   0,   1,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_REAPER, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_BARRACKS }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_HELLION,            sc2::Race::Terran,    0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_HELLION, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_FACTORY }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_CYCLONE,            sc2::Race::Terran,    0,   0,   3,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_CYCLONE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_FACTORY }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_SIEGETANK,          sc2::Race::Terran,    0,   0,   3,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_SIEGETANK, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_FACTORY }, { sc2::UNIT_TYPEID::TERRAN_TECHLAB, sc2::UNIT_TYPEID::TERRAN_BARRACKSTECHLAB, sc2::UNIT_TYPEID::TERRAN_FACTORYTECHLAB, sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB }, {} },
+        { sc2::UNIT_TYPEID::TERRAN_THOR,               sc2::Race::Terran,    0,   0,   6,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_THOR, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_FACTORY }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_WIDOWMINE,          sc2::Race::Terran,    0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_WIDOWMINE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_FACTORY }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_NUKE,               sc2::Race::Terran,    0,   0,   0,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::BUILD_NUKE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_GHOSTACADEMY }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_BANSHEE,            sc2::Race::Terran,    0,   0,   3,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_BANSHEE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_STARPORT }, { sc2::UNIT_TYPEID::TERRAN_TECHLAB, sc2::UNIT_TYPEID::TERRAN_BARRACKSTECHLAB, sc2::UNIT_TYPEID::TERRAN_FACTORYTECHLAB, sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB }, {} },
+        { sc2::UNIT_TYPEID::TERRAN_BATTLECRUISER,      sc2::Race::Terran,    0,   0,   6,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_BATTLECRUISER, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_STARPORT }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_LIBERATOR,          sc2::Race::Terran,    0,   0,   3,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_LIBERATOR, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_STARPORT }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_VIKINGFIGHTER,      sc2::Race::Terran,    0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_VIKINGFIGHTER, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_STARPORT }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_RAVEN,              sc2::Race::Terran,    0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_RAVEN, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_STARPORT }, { sc2::UNIT_TYPEID::TERRAN_TECHLAB, sc2::UNIT_TYPEID::TERRAN_BARRACKSTECHLAB, sc2::UNIT_TYPEID::TERRAN_FACTORYTECHLAB, sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB }, {} },
+        { sc2::UNIT_TYPEID::TERRAN_MEDIVAC,            sc2::Race::Terran,    0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_MEDIVAC, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_STARPORT }, {}, {} },
+        { sc2::UNIT_TYPEID::TERRAN_MULE,               sc2::Race::Terran,    0,   0,   0,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::EFFECT_CALLDOWNMULE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMAND }, {}, {} },
+
+        // Zerg Buildings
+        { sc2::UNIT_TYPEID::ZERG_HATCHERY,             sc2::Race::Zerg,      0,   0,   0,   0,  true,  true, false, false, false,  true, false, sc2::ABILITY_ID::BUILD_HATCHERY, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_DRONE }, {}, {} },
+        { sc2::UNIT_TYPEID::ZERG_EXTRACTOR,            sc2::Race::Zerg,      0,   0,   0,   0,  true,  true, false,  true, false, false, false, sc2::ABILITY_ID::BUILD_EXTRACTOR, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_DRONE }, {}, {} },
+        { sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL,         sc2::Race::Zerg,      0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_SPAWNINGPOOL, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_DRONE }, { sc2::UNIT_TYPEID::ZERG_HATCHERY, sc2::UNIT_TYPEID::ZERG_LAIR, sc2::UNIT_TYPEID::ZERG_HIVE }, {} },
+        { sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER,     sc2::Race::Zerg,      0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_EVOLUTIONCHAMBER, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_DRONE }, { sc2::UNIT_TYPEID::ZERG_HATCHERY, sc2::UNIT_TYPEID::ZERG_LAIR, sc2::UNIT_TYPEID::ZERG_HIVE }, {} },
+        { sc2::UNIT_TYPEID::ZERG_BANELINGNEST,         sc2::Race::Zerg,      0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_BANELINGNEST, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_DRONE }, { sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL }, {} },
+        { sc2::UNIT_TYPEID::ZERG_HYDRALISKDEN,         sc2::Race::Zerg,      0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_HYDRALISKDEN, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_DRONE }, { sc2::UNIT_TYPEID::ZERG_LAIR, sc2::UNIT_TYPEID::ZERG_HIVE }, {} },
+        { sc2::UNIT_TYPEID::ZERG_INFESTATIONPIT,       sc2::Race::Zerg,      0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_INFESTATIONPIT, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_DRONE }, { sc2::UNIT_TYPEID::ZERG_LAIR, sc2::UNIT_TYPEID::ZERG_HIVE }, {} },
+        { sc2::UNIT_TYPEID::ZERG_NYDUSCANAL,           sc2::Race::Zerg,      0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_NYDUSWORM, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_DRONE }, { sc2::UNIT_TYPEID::ZERG_NYDUSNETWORK }, {} },
+        { sc2::UNIT_TYPEID::ZERG_NYDUSNETWORK,         sc2::Race::Zerg,      0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_NYDUSNETWORK, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_DRONE }, { sc2::UNIT_TYPEID::ZERG_LAIR, sc2::UNIT_TYPEID::ZERG_HIVE }, {} },
+        { sc2::UNIT_TYPEID::ZERG_ROACHWARREN,          sc2::Race::Zerg,      0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_ROACHWARREN, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_DRONE }, { sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL }, {} },
+        { sc2::UNIT_TYPEID::ZERG_SPINECRAWLER,         sc2::Race::Zerg,      0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_SPINECRAWLER, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_DRONE }, { sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL }, {} },
+        { sc2::UNIT_TYPEID::ZERG_SPIRE,                sc2::Race::Zerg,      0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_SPIRE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_DRONE }, { sc2::UNIT_TYPEID::ZERG_LAIR, sc2::UNIT_TYPEID::ZERG_HIVE }, {} },
+        { sc2::UNIT_TYPEID::ZERG_GREATERSPIRE,         sc2::Race::Zerg,      0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::MORPH_GREATERSPIRE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_SPIRE }, { sc2::UNIT_TYPEID::ZERG_HIVE }, {} },
+        { sc2::UNIT_TYPEID::ZERG_SPORECRAWLER,         sc2::Race::Zerg,      0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_SPORECRAWLER, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_DRONE }, { sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL }, {} },
+        { sc2::UNIT_TYPEID::ZERG_ULTRALISKCAVERN,      sc2::Race::Zerg,      0,   0,   0,   0,  true,  true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_ULTRALISKCAVERN, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_DRONE }, { sc2::UNIT_TYPEID::ZERG_HIVE }, {} },
+        { sc2::UNIT_TYPEID::ZERG_LAIR,                 sc2::Race::Zerg,      0,   0,   0,   0,  true,  true, false, false, false,  true, false, sc2::ABILITY_ID::MORPH_LAIR, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_HATCHERY }, { sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL }, {} },
+        { sc2::UNIT_TYPEID::ZERG_HIVE,                 sc2::Race::Zerg,      0,   0,   0,   0,  true,  true, false, false, false,  true, false, sc2::ABILITY_ID::MORPH_HIVE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_LAIR }, { sc2::UNIT_TYPEID::ZERG_INFESTATIONPIT }, {} },
+
+        // Zerg Units
+        { sc2::UNIT_TYPEID::ZERG_OVERLORD,             sc2::Race::Zerg,      0,   0,   0,   0,  true, false, false, false,  true, false, false, sc2::ABILITY_ID::TRAIN_OVERLORD, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_LARVA }, {}, {} },
+        { sc2::UNIT_TYPEID::ZERG_BANELING,             sc2::Race::Zerg,      0,   0,   0,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_BANELING, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_LARVA }, { sc2::UNIT_TYPEID::ZERG_BANELINGNEST }, {} },
+        { sc2::UNIT_TYPEID::ZERG_CORRUPTOR,            sc2::Race::Zerg,      0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_CORRUPTOR, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_LARVA }, { sc2::UNIT_TYPEID::ZERG_SPIRE, sc2::UNIT_TYPEID::ZERG_GREATERSPIRE }, {} },
+        { sc2::UNIT_TYPEID::ZERG_DRONE,                sc2::Race::Zerg,      0,   0,   1,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_DRONE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_LARVA }, {}, {} },
+        { sc2::UNIT_TYPEID::ZERG_HYDRALISK,            sc2::Race::Zerg,      0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_HYDRALISK, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_LARVA }, { sc2::UNIT_TYPEID::ZERG_HYDRALISKDEN, sc2::UNIT_TYPEID::ZERG_LURKERDENMP }, {} },
+        { sc2::UNIT_TYPEID::ZERG_INFESTOR,             sc2::Race::Zerg,      0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_INFESTOR, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_LARVA }, { sc2::UNIT_TYPEID::ZERG_INFESTATIONPIT }, {} },
+        { sc2::UNIT_TYPEID::ZERG_MUTALISK,             sc2::Race::Zerg,      0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_MUTALISK, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_LARVA }, { sc2::UNIT_TYPEID::ZERG_SPIRE, sc2::UNIT_TYPEID::ZERG_GREATERSPIRE }, {} },
+        { sc2::UNIT_TYPEID::ZERG_ROACH,                sc2::Race::Zerg,      0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_ROACH, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_LARVA }, { sc2::UNIT_TYPEID::ZERG_ROACHWARREN }, {} },
+        { sc2::UNIT_TYPEID::ZERG_SWARMHOSTMP,          sc2::Race::Zerg,      0,   0,   3,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_SWARMHOST, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_LARVA }, { sc2::UNIT_TYPEID::ZERG_INFESTATIONPIT }, {} },
+        { sc2::UNIT_TYPEID::ZERG_ULTRALISK,            sc2::Race::Zerg,      0,   0,   6,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_ULTRALISK, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_LARVA }, { sc2::UNIT_TYPEID::ZERG_ULTRALISKCAVERN }, {} },
+        { sc2::UNIT_TYPEID::ZERG_VIPER,                sc2::Race::Zerg,      0,   0,   3,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_VIPER, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_LARVA }, { sc2::UNIT_TYPEID::ZERG_HIVE }, {} },
+        { sc2::UNIT_TYPEID::ZERG_ZERGLING,             sc2::Race::Zerg,      0,   0,   1,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_ZERGLING, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_LARVA }, { sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL }, {} },
+        { sc2::UNIT_TYPEID::ZERG_QUEEN,                sc2::Race::Zerg,      0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_QUEEN, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_HATCHERY, sc2::UNIT_TYPEID::ZERG_LAIR, sc2::UNIT_TYPEID::ZERG_HIVE }, { sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL }, {} },
+        { sc2::UNIT_TYPEID::ZERG_LARVA,                sc2::Race::Zerg,      0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::INVALID, sc2::ABILITY_ID::INVALID, {}, {}, {} },
+        { sc2::UNIT_TYPEID::ZERG_EGG,                  sc2::Race::Zerg,      0,   0,   2,   0,  true, false, false, false, false, false, false, sc2::ABILITY_ID::INVALID, sc2::ABILITY_ID::INVALID, {}, {}, {} },
+    };
+
+    constexpr TechTreeAlias UnitTypeAliases[] =
+    {
+        { sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOTLOWERED,    sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOT },
+        { sc2::UNIT_TYPEID::TERRAN_BARRACKSFLYING,        sc2::UNIT_TYPEID::TERRAN_BARRACKS },
+        { sc2::UNIT_TYPEID::TERRAN_COMMANDCENTERFLYING,   sc2::UNIT_TYPEID::TERRAN_COMMANDCENTER },
+        { sc2::UNIT_TYPEID::TERRAN_FACTORYFLYING,         sc2::UNIT_TYPEID::TERRAN_FACTORY },
+        { sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMANDFLYING,  sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMAND },
+        { sc2::UNIT_TYPEID::TERRAN_STARPORTFLYING,        sc2::UNIT_TYPEID::TERRAN_STARPORT },
+    };
+
+    constexpr TechTreeEntry<sc2::UPGRADE_ID> UpgradeTable[] =
+    {
+        //                                                       m    g    s    t  unit   bld    wrk    rfn    sup   hall    add
+        // Terran Upgrades
+        { sc2::UPGRADE_ID::BANSHEECLOAK,                        sc2::Race::Terran,  100, 100,   0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_BANSHEECLOAKINGFIELD, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB }, {}, {} },
+        { sc2::UPGRADE_ID::BANSHEESPEED,                        sc2::Race::Terran,  200, 200,   0, 2720, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_BANSHEEHYPERFLIGHTROTORS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB }, {}, {} },
+        { sc2::UPGRADE_ID::BATTLECRUISERENABLESPECIALIZATIONS,  sc2::Race::Terran,  150, 150,   0, 960, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_BATTLECRUISERWEAPONREFIT, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_SCV }, {}, {} },
+        { sc2::UPGRADE_ID::DRILLCLAWS,                          sc2::Race::Terran,  150, 150,   0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_DRILLINGCLAWS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_FACTORYTECHLAB }, {}, {} },
+        { sc2::UPGRADE_ID::HIGHCAPACITYBARRELS,                 sc2::Race::Terran,  150, 150,   0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_INFERNALPREIGNITER, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB }, {}, {} },
+        { sc2::UPGRADE_ID::HISECAUTOTRACKING,                   sc2::Race::Terran,  100, 100,   0, 1280, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_HISECAUTOTRACKING, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY }, {}, {} },
+        { sc2::UPGRADE_ID::LIBERATORAGRANGEUPGRADE,             sc2::Race::Terran,  150, 150,   0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ADVANCEDBALLISTICS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB }, {}, {} },
+        { sc2::UPGRADE_ID::MAGFIELDLAUNCHERS,                   sc2::Race::Terran,  100, 100,   0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_MAGFIELDLAUNCHERS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_FACTORYTECHLAB }, {}, {} },
+        { sc2::UPGRADE_ID::MEDIVACINCREASESPEEDBOOST,           sc2::Race::Terran,  100, 100,   0, 1280, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_HIGHCAPACITYFUELTANKS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_SCV }, {}, {} },
+        { sc2::UPGRADE_ID::NEOSTEELFRAME,                       sc2::Race::Terran,  100, 100,   0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_NEOSTEELFRAME, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY }, {}, {} },
+        { sc2::UPGRADE_ID::PERSONALCLOAKING,                    sc2::Race::Terran,  150, 150,   0, 1920, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PERSONALCLOAKING, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_GHOSTACADEMY }, {}, {} },
+        { sc2::UPGRADE_ID::PUNISHERGRENADES,                    sc2::Race::Terran,   50,  50,   0, 960, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_CONCUSSIVESHELLS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_BARRACKSTECHLAB }, {}, {} },
+        { sc2::UPGRADE_ID::RAVENCORVIDREACTOR,                  sc2::Race::Terran,  150, 150,   0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_RAVENCORVIDREACTOR, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_SCV }, {}, {} },
+        { sc2::UPGRADE_ID::RAVENRECALIBRATEDEXPLOSIVES,         sc2::Race::Terran,  150, 150,   0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_RAVENRECALIBRATEDEXPLOSIVES, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_SCV }, {}, {} },
+        { sc2::UPGRADE_ID::SHIELDWALL,                          sc2::Race::Terran,  100, 100,   0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_COMBATSHIELD, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_BARRACKSTECHLAB }, {}, {} },
+        { sc2::UPGRADE_ID::STIMPACK,                            sc2::Race::Terran,  100, 100,   0, 2720, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_STIMPACK, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_BARRACKSTECHLAB }, {}, {} },
+        { sc2::UPGRADE_ID::TERRANBUILDINGARMOR,                 sc2::Race::Terran,  150, 150,   0, 2240, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANSTRUCTUREARMORUPGRADE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY }, {}, {} },
+        { sc2::UPGRADE_ID::TERRANINFANTRYARMORSLEVEL1,          sc2::Race::Terran,  100, 100,   0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANINFANTRYARMOR, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY }, {}, {} },
+        { sc2::UPGRADE_ID::TERRANINFANTRYARMORSLEVEL2,          sc2::Race::Terran,  175, 175,   0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANINFANTRYARMOR, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY }, { sc2::UNIT_TYPEID::TERRAN_ARMORY }, { sc2::UPGRADE_ID::TERRANINFANTRYARMORSLEVEL1 } },
+        { sc2::UPGRADE_ID::TERRANINFANTRYARMORSLEVEL3,          sc2::Race::Terran,  250, 250,   0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANINFANTRYARMOR, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY }, { sc2::UNIT_TYPEID::TERRAN_ARMORY }, { sc2::UPGRADE_ID::TERRANINFANTRYARMORSLEVEL2 } },
+        { sc2::UPGRADE_ID::TERRANINFANTRYWEAPONSLEVEL1,         sc2::Race::Terran,  100, 100,   0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANINFANTRYWEAPONS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY }, {}, {} }, //custom edited ability to properly research armor/inf upg
+        { sc2::UPGRADE_ID::TERRANINFANTRYWEAPONSLEVEL2,         sc2::Race::Terran,  175, 175,   0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANINFANTRYWEAPONS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY }, { sc2::UNIT_TYPEID::TERRAN_ARMORY }, { sc2::UPGRADE_ID::TERRANINFANTRYWEAPONSLEVEL1 } },
+        { sc2::UPGRADE_ID::TERRANINFANTRYWEAPONSLEVEL3,         sc2::Race::Terran,  250, 250,   0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANINFANTRYWEAPONS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY }, { sc2::UNIT_TYPEID::TERRAN_ARMORY }, { sc2::UPGRADE_ID::TERRANINFANTRYWEAPONSLEVEL2 } },
+        { sc2::UPGRADE_ID::TERRANSHIPWEAPONSLEVEL1,             sc2::Race::Terran,  100, 100,   0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANSHIPWEAPONS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ARMORY }, {}, {} },
+        { sc2::UPGRADE_ID::TERRANSHIPWEAPONSLEVEL2,             sc2::Race::Terran,  175, 175,   0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANSHIPWEAPONS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ARMORY }, {}, { sc2::UPGRADE_ID::TERRANSHIPWEAPONSLEVEL1 } },
+        { sc2::UPGRADE_ID::TERRANSHIPWEAPONSLEVEL3,             sc2::Race::Terran,  250, 250,   0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANSHIPWEAPONS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ARMORY }, {}, { sc2::UPGRADE_ID::TERRANSHIPWEAPONSLEVEL2 } },
+        { sc2::UPGRADE_ID::TERRANVEHICLEANDSHIPARMORSLEVEL1,    sc2::Race::Terran,  100, 100,   0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANVEHICLEANDSHIPPLATING, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ARMORY }, {}, {} },
+        { sc2::UPGRADE_ID::TERRANVEHICLEANDSHIPARMORSLEVEL2,    sc2::Race::Terran,  175, 175,   0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANVEHICLEANDSHIPPLATING, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ARMORY }, {}, { sc2::UPGRADE_ID::TERRANVEHICLEANDSHIPARMORSLEVEL1 } },
+        { sc2::UPGRADE_ID::TERRANVEHICLEANDSHIPARMORSLEVEL3,    sc2::Race::Terran,  250, 250,   0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANVEHICLEANDSHIPPLATING, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ARMORY }, {}, { sc2::UPGRADE_ID::TERRANVEHICLEANDSHIPARMORSLEVEL2 } },
+        { sc2::UPGRADE_ID::TERRANVEHICLEWEAPONSLEVEL1,          sc2::Race::Terran,  100, 100,   0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANVEHICLEWEAPONS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ARMORY }, {}, {} },
+        { sc2::UPGRADE_ID::TERRANVEHICLEWEAPONSLEVEL2,          sc2::Race::Terran,  175, 175,   0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANVEHICLEWEAPONS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ARMORY }, {}, { sc2::UPGRADE_ID::TERRANVEHICLEWEAPONSLEVEL1 } },
+        { sc2::UPGRADE_ID::TERRANVEHICLEWEAPONSLEVEL3,          sc2::Race::Terran,  250, 250,   0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANVEHICLEWEAPONS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::TERRAN_ARMORY }, {}, { sc2::UPGRADE_ID::TERRANVEHICLEWEAPONSLEVEL2 } },
+
+        // Protoss Upgrades
+        { sc2::UPGRADE_ID::ADEPTPIERCINGATTACK,                 sc2::Race::Protoss, 100, 100,   0, 2240, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ADEPTRESONATINGGLAIVES, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL }, {}, {} },
+        { sc2::UPGRADE_ID::BLINKTECH,                           sc2::Race::Protoss, 150, 150,   0, 2720, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_BLINK, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL }, {}, {} },
+        { sc2::UPGRADE_ID::CARRIERLAUNCHSPEEDUPGRADE,           sc2::Race::Protoss, 150, 150,   0, 1280, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_INTERCEPTORGRAVITONCATAPULT, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON }, {}, {} },
+        { sc2::UPGRADE_ID::CHARGE,                              sc2::Race::Protoss, 100, 100,   0, 2240, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_CHARGE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL }, {}, {} },
+        { sc2::UPGRADE_ID::DARKTEMPLARBLINKUPGRADE,             sc2::Race::Protoss, 100, 100,   0, 2720, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_SHADOWSTRIKE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_DARKSHRINE }, {}, {} },
+        { sc2::UPGRADE_ID::EXTENDEDTHERMALLANCE,                sc2::Race::Protoss, 200, 200,   0, 2240, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_EXTENDEDTHERMALLANCE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_ROBOTICSBAY }, {}, {} },
+        { sc2::UPGRADE_ID::GRAVITICDRIVE,                       sc2::Race::Protoss, 100, 100,   0, 1280, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_GRAVITICDRIVE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_ROBOTICSBAY }, {}, {} },
+        { sc2::UPGRADE_ID::OBSERVERGRAVITICBOOSTER,             sc2::Race::Protoss, 100, 100,   0, 1280, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_GRAVITICBOOSTER, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_ROBOTICSBAY }, {}, {} },
+        { sc2::UPGRADE_ID::PHOENIXRANGEUPGRADE,                 sc2::Race::Protoss, 150, 150,   0, 1440, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PHOENIXANIONPULSECRYSTALS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON }, {}, {} },
+        { sc2::UPGRADE_ID::PROTOSSAIRARMORSLEVEL1,              sc2::Race::Protoss, 150, 150,   0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSAIRARMORLEVEL1, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE }, {}, {} },
+        { sc2::UPGRADE_ID::PROTOSSAIRARMORSLEVEL2,              sc2::Race::Protoss, 225, 225,   0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSAIRARMORLEVEL2, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE }, { sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON }, { sc2::UPGRADE_ID::PROTOSSAIRARMORSLEVEL1 } },
+        { sc2::UPGRADE_ID::PROTOSSAIRARMORSLEVEL3,              sc2::Race::Protoss, 300, 300,   0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSAIRARMORLEVEL3, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE }, { sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON }, { sc2::UPGRADE_ID::PROTOSSAIRARMORSLEVEL2 } },
+        { sc2::UPGRADE_ID::PROTOSSAIRWEAPONSLEVEL1,             sc2::Race::Protoss, 100, 100,   0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSAIRWEAPONSLEVEL1, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE }, {}, {} },
+        { sc2::UPGRADE_ID::PROTOSSAIRWEAPONSLEVEL2,             sc2::Race::Protoss, 175, 175,   0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSAIRWEAPONSLEVEL2, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE }, { sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON }, { sc2::UPGRADE_ID::PROTOSSAIRWEAPONSLEVEL1 } },
+        { sc2::UPGRADE_ID::PROTOSSAIRWEAPONSLEVEL3,             sc2::Race::Protoss, 250, 250,   0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSAIRWEAPONSLEVEL3, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE }, { sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON }, { sc2::UPGRADE_ID::PROTOSSAIRWEAPONSLEVEL3 } },
+        { sc2::UPGRADE_ID::PROTOSSGROUNDARMORSLEVEL1,           sc2::Race::Protoss, 100, 100,   0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSGROUNDARMORLEVEL1, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_FORGE }, {}, {} },
+        { sc2::UPGRADE_ID::PROTOSSGROUNDARMORSLEVEL2,           sc2::Race::Protoss, 150, 150,   0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSGROUNDARMORLEVEL2, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_FORGE }, { sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL }, { sc2::UPGRADE_ID::PROTOSSGROUNDARMORSLEVEL1 } },
+        { sc2::UPGRADE_ID::PROTOSSGROUNDARMORSLEVEL3,           sc2::Race::Protoss, 200, 200,   0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSGROUNDARMORLEVEL3, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_FORGE }, { sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL }, { sc2::UPGRADE_ID::PROTOSSGROUNDARMORSLEVEL2 } },
+        { sc2::UPGRADE_ID::PROTOSSGROUNDWEAPONSLEVEL1,          sc2::Race::Protoss, 100, 100,   0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSGROUNDWEAPONSLEVEL1, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_FORGE }, {}, {} },
+        { sc2::UPGRADE_ID::PROTOSSGROUNDWEAPONSLEVEL2,          sc2::Race::Protoss, 150, 150,   0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSGROUNDWEAPONSLEVEL2, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_FORGE }, { sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL }, { sc2::UPGRADE_ID::PROTOSSGROUNDWEAPONSLEVEL1 } },
+        { sc2::UPGRADE_ID::PROTOSSGROUNDWEAPONSLEVEL3,          sc2::Race::Protoss, 200, 200,   0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSGROUNDWEAPONSLEVEL3, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_FORGE }, { sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL }, { sc2::UPGRADE_ID::PROTOSSGROUNDWEAPONSLEVEL2 } },
+        { sc2::UPGRADE_ID::PROTOSSSHIELDSLEVEL1,                sc2::Race::Protoss, 150, 150,   0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSSHIELDSLEVEL1, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_FORGE }, {}, {} },
+        { sc2::UPGRADE_ID::PROTOSSSHIELDSLEVEL2,                sc2::Race::Protoss, 225, 225,   0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSSHIELDSLEVEL2, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_FORGE }, { sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL }, { sc2::UPGRADE_ID::PROTOSSSHIELDSLEVEL1 } },
+        { sc2::UPGRADE_ID::PROTOSSSHIELDSLEVEL3,                sc2::Race::Protoss, 300, 300,   0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSSHIELDSLEVEL3, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_FORGE }, { sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL }, { sc2::UPGRADE_ID::PROTOSSSHIELDSLEVEL2 } },
+        { sc2::UPGRADE_ID::PSISTORMTECH,                        sc2::Race::Protoss, 200, 200,   0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PSISTORM, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_TEMPLARARCHIVE }, {}, {} },
+        { sc2::UPGRADE_ID::WARPGATERESEARCH,                    sc2::Race::Protoss,  50,  50,   0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_WARPGATE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE }, {}, {} },
+
+        // Zerg Upgrades
+        { sc2::UPGRADE_ID::BURROW,                              sc2::Race::Zerg,    100, 100,   0, 1600, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_BURROW, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_HATCHERY, sc2::UNIT_TYPEID::ZERG_LAIR, sc2::UNIT_TYPEID::ZERG_HIVE }, {}, {} },
+        { sc2::UPGRADE_ID::CENTRIFICALHOOKS,                    sc2::Race::Zerg,    150, 150,   0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_CENTRIFUGALHOOKS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_BANELINGNEST }, {}, {} },
+        { sc2::UPGRADE_ID::CHITINOUSPLATING,                    sc2::Race::Zerg,    150, 150,   0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_CHITINOUSPLATING, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_ULTRALISKCAVERN }, {}, {} },
+        { sc2::UPGRADE_ID::EVOLVEGROOVEDSPINES,                 sc2::Race::Zerg,    150, 150,   0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_GROOVEDSPINES, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_HYDRALISKDEN }, {}, {} },
+        { sc2::UPGRADE_ID::EVOLVEMUSCULARAUGMENTS,              sc2::Race::Zerg,    150, 150,   0, 1600, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_MUSCULARAUGMENTS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_HYDRALISKDEN }, {}, {} },
+        { sc2::UPGRADE_ID::GLIALRECONSTITUTION,                 sc2::Race::Zerg,    100, 100,   0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_GLIALREGENERATION, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_ROACHWARREN }, { sc2::UNIT_TYPEID::ZERG_LAIR, sc2::UNIT_TYPEID::ZERG_HIVE }, {} },
+        { sc2::UPGRADE_ID::INFESTORENERGYUPGRADE,               sc2::Race::Zerg,    150, 150,   0, 1280, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PATHOGENGLANDS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_INFESTATIONPIT }, {}, {} },
+        { sc2::UPGRADE_ID::NEURALPARASITE,                      sc2::Race::Zerg,    150, 150,   0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_NEURALPARASITE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_INFESTATIONPIT }, {}, {} },
+        { sc2::UPGRADE_ID::OVERLORDSPEED,                       sc2::Race::Zerg,    100, 100,   0, 960, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PNEUMATIZEDCARAPACE, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_HATCHERY, sc2::UNIT_TYPEID::ZERG_LAIR, sc2::UNIT_TYPEID::ZERG_HIVE }, {}, {} },
+        { sc2::UPGRADE_ID::TUNNELINGCLAWS,                      sc2::Race::Zerg,    150, 150,   0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TUNNELINGCLAWS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_ROACHWARREN }, { sc2::UNIT_TYPEID::ZERG_LAIR, sc2::UNIT_TYPEID::ZERG_HIVE }, {} },
+        { sc2::UPGRADE_ID::ZERGFLYERARMORSLEVEL1,               sc2::Race::Zerg,    150, 150,   0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGFLYERARMORLEVEL1, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_SPIRE, sc2::UNIT_TYPEID::ZERG_GREATERSPIRE }, {}, {} },
+        { sc2::UPGRADE_ID::ZERGFLYERARMORSLEVEL2,               sc2::Race::Zerg,    225, 225,   0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGFLYERARMORLEVEL2, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_SPIRE, sc2::UNIT_TYPEID::ZERG_GREATERSPIRE }, { sc2::UNIT_TYPEID::ZERG_LAIR, sc2::UNIT_TYPEID::ZERG_HIVE }, { sc2::UPGRADE_ID::ZERGFLYERARMORSLEVEL1 } },
+        { sc2::UPGRADE_ID::ZERGFLYERARMORSLEVEL3,               sc2::Race::Zerg,    300, 300,   0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGFLYERARMORLEVEL3, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_SPIRE, sc2::UNIT_TYPEID::ZERG_GREATERSPIRE }, { sc2::UNIT_TYPEID::ZERG_HIVE }, { sc2::UPGRADE_ID::ZERGFLYERARMORSLEVEL2 } },
+        { sc2::UPGRADE_ID::ZERGFLYERWEAPONSLEVEL1,              sc2::Race::Zerg,    100, 100,   0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGFLYERATTACKLEVEL1, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_SPIRE, sc2::UNIT_TYPEID::ZERG_GREATERSPIRE }, {}, {} },
+        { sc2::UPGRADE_ID::ZERGFLYERWEAPONSLEVEL2,              sc2::Race::Zerg,    175, 175,   0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGFLYERATTACKLEVEL2, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_SPIRE, sc2::UNIT_TYPEID::ZERG_GREATERSPIRE }, { sc2::UNIT_TYPEID::ZERG_LAIR, sc2::UNIT_TYPEID::ZERG_HIVE }, { sc2::UPGRADE_ID::ZERGFLYERWEAPONSLEVEL1 } },
+        { sc2::UPGRADE_ID::ZERGFLYERWEAPONSLEVEL3,              sc2::Race::Zerg,    250, 250,   0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGFLYERATTACKLEVEL3, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_SPIRE, sc2::UNIT_TYPEID::ZERG_GREATERSPIRE }, { sc2::UNIT_TYPEID::ZERG_HIVE }, { sc2::UPGRADE_ID::ZERGFLYERWEAPONSLEVEL2 } },
+        { sc2::UPGRADE_ID::ZERGGROUNDARMORSLEVEL1,              sc2::Race::Zerg,    150, 150,   0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGGROUNDARMORLEVEL1, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER }, {}, {} },
+        { sc2::UPGRADE_ID::ZERGGROUNDARMORSLEVEL2,              sc2::Race::Zerg,    225, 225,   0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGGROUNDARMORLEVEL2, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER }, { sc2::UNIT_TYPEID::ZERG_LAIR, sc2::UNIT_TYPEID::ZERG_HIVE }, { sc2::UPGRADE_ID::ZERGGROUNDARMORSLEVEL1 } },
+        { sc2::UPGRADE_ID::ZERGGROUNDARMORSLEVEL3,              sc2::Race::Zerg,    300, 300,   0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGGROUNDARMORLEVEL3, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER }, { sc2::UNIT_TYPEID::ZERG_HIVE }, { sc2::UPGRADE_ID::ZERGGROUNDARMORSLEVEL2 } },
+        { sc2::UPGRADE_ID::ZERGLINGATTACKSPEED,                 sc2::Race::Zerg,    200, 200,   0, 2080, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGLINGADRENALGLANDS, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL }, { sc2::UNIT_TYPEID::ZERG_HIVE }, {} },
+        { sc2::UPGRADE_ID::ZERGLINGMOVEMENTSPEED,               sc2::Race::Zerg,    100, 100,   0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGLINGMETABOLICBOOST, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL }, {}, {} },
+        { sc2::UPGRADE_ID::ZERGMELEEWEAPONSLEVEL1,              sc2::Race::Zerg,    100, 100,   0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGMELEEWEAPONSLEVEL1, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER }, {}, {} },
+        { sc2::UPGRADE_ID::ZERGMELEEWEAPONSLEVEL2,              sc2::Race::Zerg,    150, 150,   0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGMELEEWEAPONSLEVEL2, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER }, { sc2::UNIT_TYPEID::ZERG_LAIR, sc2::UNIT_TYPEID::ZERG_HIVE }, { sc2::UPGRADE_ID::ZERGMELEEWEAPONSLEVEL1 } },
+        { sc2::UPGRADE_ID::ZERGMELEEWEAPONSLEVEL3,              sc2::Race::Zerg,    200, 200,   0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGMELEEWEAPONSLEVEL3, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER }, { sc2::UNIT_TYPEID::ZERG_HIVE }, { sc2::UPGRADE_ID::ZERGMELEEWEAPONSLEVEL2 } },
+        { sc2::UPGRADE_ID::ZERGMISSILEWEAPONSLEVEL1,            sc2::Race::Zerg,    100, 100,   0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGMISSILEWEAPONSLEVEL1, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER }, {}, {} },
+        { sc2::UPGRADE_ID::ZERGMISSILEWEAPONSLEVEL2,            sc2::Race::Zerg,    150, 150,   0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGMISSILEWEAPONSLEVEL2, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER }, { sc2::UNIT_TYPEID::ZERG_LAIR, sc2::UNIT_TYPEID::ZERG_HIVE }, { sc2::UPGRADE_ID::ZERGMISSILEWEAPONSLEVEL1 } },
+        { sc2::UPGRADE_ID::ZERGMISSILEWEAPONSLEVEL3,            sc2::Race::Zerg,    200, 200,   0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGMISSILEWEAPONSLEVEL3, sc2::ABILITY_ID::INVALID, { sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER }, { sc2::UNIT_TYPEID::ZERG_HIVE }, { sc2::UPGRADE_ID::ZERGMISSILEWEAPONSLEVEL2 } },
+    };
+
+    template <class ID>
+    TypeData MakeTypeData(const TechTreeEntry<ID> & entry, CCBot & bot)
+    {
+        TypeData data;
+        data.race             = entry.race;
+        data.mineralCost      = entry.mineralCost;
+        data.gasCost          = entry.gasCost;
+        data.supplyCost       = entry.supplyCost;
+        data.buildTime        = entry.buildTime;
+        data.isUnit           = entry.isUnit;
+        data.isBuilding       = entry.isBuilding;
+        data.isWorker         = entry.isWorker;
+        data.isRefinery       = entry.isRefinery;
+        data.isSupplyProvider = entry.isSupplyProvider;
+        data.isResourceDepot  = entry.isResourceDepot;
+        data.isAddon          = entry.isAddon;
+        data.buildAbility     = entry.buildAbility;
+        data.warpAbility      = entry.warpAbility;
+
+        for (auto type : entry.whatBuilds)
+        {
+            if (type != sc2::UNIT_TYPEID::INVALID) { data.whatBuilds.push_back(UnitType(type, bot)); }
+        }
+
+        for (auto type : entry.requiredUnits)
+        {
+            if (type != sc2::UNIT_TYPEID::INVALID) { data.requiredUnits.push_back(UnitType(type, bot)); }
+        }
+
+        for (auto upgrade : entry.requiredUpgrades)
+        {
+            if (upgrade != sc2::UPGRADE_ID::INVALID) { data.requiredUpgrades.push_back(upgrade); }
+        }
+
+        return data;
+    }
+}
+
 void TechTree::initUnitTypeData()
 {
-    m_unitTypeData[UnitType(0, m_bot)] = TypeData();
-
-    // Protoss Buildings                                                                                  unit  bld   wrk    rfn    sup    hall   add
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_PYLONOVERCHARGED, m_bot)] =        { sc2::Race::Protoss, 0, 0, 0, 0, true, true, false, false,  true, false, false, sc2::ABILITY_ID::EFFECT_PHOTONOVERCHARGE, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_MOTHERSHIPCORE, m_bot), UnitType(sc2::UNIT_TYPEID::PROTOSS_PYLON, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_PYLON, m_bot)] =                   { sc2::Race::Protoss, 0, 0, 0, 0, true, true, false, false,  true, false, false, sc2::ABILITY_ID::BUILD_PYLON, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_PROBE, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_NEXUS, m_bot)] =                   { sc2::Race::Protoss, 0, 0, 0, 0, true, true, false, false, false,  true, false, sc2::ABILITY_ID::BUILD_NEXUS, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_PROBE, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_ASSIMILATOR, m_bot)] =             { sc2::Race::Protoss, 0, 0, 0, 0, true, true, false,  true, false, false, false, sc2::ABILITY_ID::BUILD_ASSIMILATOR, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_PROBE, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE, m_bot)] =         { sc2::Race::Protoss, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_CYBERNETICSCORE, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_PROBE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_GATEWAY, m_bot), UnitType(sc2::UNIT_TYPEID::PROTOSS_WARPGATE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_DARKSHRINE, m_bot)] =              { sc2::Race::Protoss, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_DARKSHRINE, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_PROBE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON, m_bot)] =             { sc2::Race::Protoss, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_FLEETBEACON, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_PROBE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_STARGATE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_FORGE, m_bot)] =                   { sc2::Race::Protoss, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_FORGE, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_PROBE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_NEXUS, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_GATEWAY, m_bot)] =                 { sc2::Race::Protoss, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_GATEWAY, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_PROBE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_NEXUS, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_STARGATE, m_bot)] =                { sc2::Race::Protoss, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_STARGATE, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_PROBE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE, m_bot) }, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_PHOTONCANNON, m_bot)] =            { sc2::Race::Protoss, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_PHOTONCANNON, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_PROBE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FORGE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_ROBOTICSBAY, m_bot)] =             { sc2::Race::Protoss, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_ROBOTICSBAY, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_PROBE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_ROBOTICSFACILITY, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_ROBOTICSFACILITY, m_bot)] =        { sc2::Race::Protoss, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_ROBOTICSFACILITY, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_PROBE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_TEMPLARARCHIVE, m_bot)] =          { sc2::Race::Protoss, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_TEMPLARARCHIVE, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_PROBE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL, m_bot)] =         { sc2::Race::Protoss, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_TWILIGHTCOUNCIL, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_PROBE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_WARPGATE, m_bot)] =                { sc2::Race::Protoss, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::MORPH_WARPGATE, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_GATEWAY, m_bot) }, {}, { sc2::UPGRADE_ID::WARPGATERESEARCH } }; 
-
-    // Protoss Units                                                                                      unit  bld   wrk    rfn    sup    hall   add
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_PROBE, m_bot)] =                   { sc2::Race::Protoss, 0, 0, 1, 0, true, false,  true, false, false, false, false, sc2::ABILITY_ID::TRAIN_PROBE, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_NEXUS, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_MOTHERSHIPCORE, m_bot)] =          { sc2::Race::Protoss, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_MOTHERSHIPCORE, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_NEXUS, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_ZEALOT, m_bot)] =                  { sc2::Race::Protoss, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_ZEALOT, sc2::ABILITY_ID::TRAINWARP_ZEALOT, { UnitType(sc2::UNIT_TYPEID::PROTOSS_GATEWAY, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_SENTRY, m_bot)] =                  { sc2::Race::Protoss, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_SENTRY, sc2::ABILITY_ID::TRAINWARP_SENTRY, { UnitType(sc2::UNIT_TYPEID::PROTOSS_GATEWAY, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_STALKER, m_bot)] =                 { sc2::Race::Protoss, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_STALKER, sc2::ABILITY_ID::TRAINWARP_STALKER, { UnitType(sc2::UNIT_TYPEID::PROTOSS_GATEWAY, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_HIGHTEMPLAR, m_bot)] =             { sc2::Race::Protoss, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_HIGHTEMPLAR, sc2::ABILITY_ID::TRAINWARP_HIGHTEMPLAR, { UnitType(sc2::UNIT_TYPEID::PROTOSS_GATEWAY, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_TEMPLARARCHIVE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_DARKTEMPLAR, m_bot)] =             { sc2::Race::Protoss, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_DARKTEMPLAR, sc2::ABILITY_ID::TRAINWARP_DARKTEMPLAR, { UnitType(sc2::UNIT_TYPEID::PROTOSS_GATEWAY, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_DARKSHRINE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_ADEPT, m_bot)] =                   { sc2::Race::Protoss, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_ADEPT, sc2::ABILITY_ID::TRAINWARP_ADEPT, { UnitType(sc2::UNIT_TYPEID::PROTOSS_GATEWAY, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_COLOSSUS, m_bot)] =                { sc2::Race::Protoss, 0, 0, 6, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_COLOSSUS,  0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_ROBOTICSFACILITY, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_ROBOTICSBAY, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_DISRUPTOR, m_bot)] =               { sc2::Race::Protoss, 0, 0, 3, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_DISRUPTOR, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_ROBOTICSFACILITY, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_ROBOTICSBAY, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_WARPPRISM, m_bot)] =               { sc2::Race::Protoss, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_WARPPRISM, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_ROBOTICSFACILITY, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_OBSERVER, m_bot)] =                { sc2::Race::Protoss, 0, 0, 1, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_OBSERVER, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_ROBOTICSFACILITY, m_bot) }, {}, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_IMMORTAL, m_bot)] =                { sc2::Race::Protoss, 0, 0, 4, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_IMMORTAL, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_ROBOTICSFACILITY, m_bot) }, {}, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_CARRIER, m_bot)] =                 { sc2::Race::Protoss, 0, 0, 6, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_CARRIER, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_STARGATE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_ORACLE, m_bot)] =                  { sc2::Race::Protoss, 0, 0, 3, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_ORACLE, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_STARGATE, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_PHOENIX, m_bot)] =                 { sc2::Race::Protoss, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_PHOENIX, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_STARGATE, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_VOIDRAY, m_bot)] =                 { sc2::Race::Protoss, 0, 0, 4, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_VOIDRAY, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_STARGATE, m_bot) }, {}, {} };  
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_TEMPEST, m_bot)] =                 { sc2::Race::Protoss, 0, 0, 4, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_TEMPEST, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_STARGATE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_INTERCEPTOR, m_bot)] =             { sc2::Race::Protoss, 0, 0, 0, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::BUILD_INTERCEPTORS, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_CARRIER, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::PROTOSS_ORACLESTASISTRAP, m_bot)] =        { sc2::Race::Protoss, 0, 0, 0, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::BUILD_STASISTRAP, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_ORACLE, m_bot) }, {}, {} }; 
-
-    // Terran Buildings                                                                      m  g  s  t  unit  bld   wrk    rfn    sup    hall   add
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_COMMANDCENTER, m_bot)] =            { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false,  true, false, sc2::ABILITY_ID::BUILD_COMMANDCENTER, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOT, m_bot)] =              { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false,  true, false, false, sc2::ABILITY_ID::BUILD_SUPPLYDEPOT, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot) }, {}, {} };  
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_REFINERY, m_bot)] =                 { sc2::Race::Terran, 0, 0, 0, 0, true, true, false,  true, false, false, false, sc2::ABILITY_ID::BUILD_REFINERY, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_ARMORY, m_bot)] =                   { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_ARMORY, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORY, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORYFLYING, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKS, m_bot)] =                 { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_BARRACKS, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOT, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOTLOWERED, m_bot) }, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_SENSORTOWER, m_bot)] =              { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_SENSORTOWER, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORY, m_bot)] =                  { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_FACTORY, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKS, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKSFLYING, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_FUSIONCORE, m_bot)] =               { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_FUSIONCORE, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORT, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORTFLYING, m_bot) }, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORT, m_bot)] =                 { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_STARPORT, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORY, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORYFLYING, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_GHOSTACADEMY, m_bot)] =             { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_GHOSTACADEMY, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKS, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKSFLYING, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_BUNKER, m_bot)] =                   { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_BUNKER, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKS, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKSFLYING, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY, m_bot)] =           { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_ENGINEERINGBAY, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_COMMANDCENTER, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_COMMANDCENTERFLYING, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_PLANETARYFORTRESS, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMAND, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMANDFLYING, m_bot) }, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_MISSILETURRET, m_bot)] =            { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_MISSILETURRET, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMAND, m_bot)] =           { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::MORPH_ORBITALCOMMAND, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_COMMANDCENTER, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKS, m_bot) }, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_PLANETARYFORTRESS, m_bot)] =        { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::MORPH_PLANETARYFORTRESS, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_COMMANDCENTER, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY, m_bot) }, {} };
-
-    // Terran Addons                                                                         m  g  s  t  unit  bld   wrk    rfn    sup    hall   add
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKSREACTOR, m_bot)] =          { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, true, sc2::ABILITY_ID::BUILD_REACTOR, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKS, m_bot) }, {}, {} }; // ability id changed from build_reactor_barracks
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKSTECHLAB, m_bot)] =          { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, true, sc2::ABILITY_ID::BUILD_TECHLAB, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKS, m_bot) }, {}, {} }; // same below.. 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORYREACTOR, m_bot)] =           { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, true, sc2::ABILITY_ID::BUILD_REACTOR, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORY, m_bot) }, {}, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORYTECHLAB, m_bot)] =           { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, true, sc2::ABILITY_ID::BUILD_TECHLAB, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORY, m_bot) }, {}, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORTREACTOR, m_bot)] =          { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, true, sc2::ABILITY_ID::BUILD_REACTOR, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORT, m_bot) }, {}, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB, m_bot)] =          { sc2::Race::Terran, 0, 0, 0, 0, true, true, false, false, false, false, true, sc2::ABILITY_ID::BUILD_TECHLAB, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORT, m_bot) }, {}, {} };
-
-    // Terran Equivalent Buildings
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOTLOWERED, m_bot)] =       m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOT, m_bot)];
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKSFLYING, m_bot)] =           m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKS, m_bot)];
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_COMMANDCENTERFLYING, m_bot)] =      m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_COMMANDCENTER, m_bot)];
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORYFLYING, m_bot)] =            m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORY, m_bot)];
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMANDFLYING, m_bot)] =     m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMAND, m_bot)];
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORTFLYING, m_bot)] =           m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORT, m_bot)];
-
-    // Terran Units                                                                          m  g  s  t  unit  bld    wrk    rfn    sup    hall   add
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot)] =                      { sc2::Race::Terran, 0, 0, 1, 0, true, false,  true, false, false, false, false, sc2::ABILITY_ID::TRAIN_SCV, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_COMMANDCENTER, m_bot),  UnitType(sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMAND, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_PLANETARYFORTRESS, m_bot) }, {}, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_GHOST, m_bot)] =                    { sc2::Race::Terran, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_GHOST, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKS, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_MARAUDER, m_bot)] =                 { sc2::Race::Terran, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_MARAUDER, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKS, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_TECHLAB, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKSTECHLAB, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORYTECHLAB, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_MARINE, m_bot)] =                   { sc2::Race::Terran, 0, 0, 1, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_MARINE, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKS, m_bot) }, {}, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_REAPER, m_bot)] =                   { sc2::Race::Terran, 0, 0, 1, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_REAPER, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKS, m_bot) }, {}, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_HELLION, m_bot)] =                  { sc2::Race::Terran, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_HELLION, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORY, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_CYCLONE, m_bot)] =                  { sc2::Race::Terran, 0, 0, 3, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_CYCLONE, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORY, m_bot) }, {}, {} };  
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_SIEGETANK, m_bot)] =                { sc2::Race::Terran, 0, 0, 3, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_SIEGETANK, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORY, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_TECHLAB, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKSTECHLAB, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORYTECHLAB, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_THOR, m_bot)] =                     { sc2::Race::Terran, 0, 0, 6, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_THOR, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORY, m_bot) }, {}, {} };  
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_WIDOWMINE, m_bot)] =                { sc2::Race::Terran, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_WIDOWMINE, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORY, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_NUKE, m_bot)] =                     { sc2::Race::Terran, 0, 0, 0, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::BUILD_NUKE, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_GHOSTACADEMY, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_BANSHEE, m_bot)] =                  { sc2::Race::Terran, 0, 0, 3, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_BANSHEE, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORT, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_TECHLAB, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKSTECHLAB, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORYTECHLAB, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_BATTLECRUISER, m_bot)] =            { sc2::Race::Terran, 0, 0, 6, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_BATTLECRUISER, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORT, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_LIBERATOR, m_bot)] =                { sc2::Race::Terran, 0, 0, 3, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_LIBERATOR, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORT, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_VIKINGFIGHTER, m_bot)] =            { sc2::Race::Terran, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_VIKINGFIGHTER, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORT, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_RAVEN, m_bot)] =                    { sc2::Race::Terran, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_RAVEN, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORT, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_TECHLAB, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKSTECHLAB, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORYTECHLAB, m_bot), UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_MEDIVAC, m_bot)] =                  { sc2::Race::Terran, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_MEDIVAC, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORT, m_bot) }, {}, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_MULE, m_bot)] =                     { sc2::Race::Terran, 0, 0, 0, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::EFFECT_CALLDOWNMULE, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMAND, m_bot) }, {}, {} }; 
-
-    // Zerg Buildings                                                                      m  g  s  t  unit  bld   wrk    rfn    sup    hall   add
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_HATCHERY, m_bot)] =                   { sc2::Race::Zerg, 0, 0, 0, 0, true, true, false, false, false,  true, false, sc2::ABILITY_ID::BUILD_HATCHERY, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_DRONE, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_EXTRACTOR, m_bot)] =                  { sc2::Race::Zerg, 0, 0, 0, 0, true, true, false,  true, false, false, false, sc2::ABILITY_ID::BUILD_EXTRACTOR, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_DRONE, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL, m_bot)] =               { sc2::Race::Zerg, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_SPAWNINGPOOL, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_DRONE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_HATCHERY, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER, m_bot)] =           { sc2::Race::Zerg, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_EVOLUTIONCHAMBER, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_DRONE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_HATCHERY, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_BANELINGNEST, m_bot)] =               { sc2::Race::Zerg, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_BANELINGNEST, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_DRONE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_HYDRALISKDEN, m_bot)] =               { sc2::Race::Zerg, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_HYDRALISKDEN, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_DRONE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_INFESTATIONPIT, m_bot)] =             { sc2::Race::Zerg, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_INFESTATIONPIT, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_DRONE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_NYDUSCANAL, m_bot)] =                 { sc2::Race::Zerg, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_NYDUSWORM, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_DRONE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_NYDUSNETWORK, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_NYDUSNETWORK, m_bot)] =               { sc2::Race::Zerg, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_NYDUSNETWORK, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_DRONE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_ROACHWARREN, m_bot)] =                { sc2::Race::Zerg, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_ROACHWARREN, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_DRONE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_SPINECRAWLER, m_bot)] =               { sc2::Race::Zerg, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_SPINECRAWLER, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_DRONE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_SPIRE, m_bot)] =                      { sc2::Race::Zerg, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_SPIRE, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_DRONE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_GREATERSPIRE, m_bot)] =               { sc2::Race::Zerg, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::MORPH_GREATERSPIRE, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_SPIRE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_SPORECRAWLER, m_bot)] =               { sc2::Race::Zerg, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_SPORECRAWLER, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_DRONE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_ULTRALISKCAVERN, m_bot)] =            { sc2::Race::Zerg, 0, 0, 0, 0, true, true, false, false, false, false, false, sc2::ABILITY_ID::BUILD_ULTRALISKCAVERN, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_DRONE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot)] =                       { sc2::Race::Zerg, 0, 0, 0, 0, true, true, false, false, false,  true, false, sc2::ABILITY_ID::MORPH_LAIR, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_HATCHERY, m_bot) }, {UnitType(sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL, m_bot)}, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot)] =                       { sc2::Race::Zerg, 0, 0, 0, 0, true, true, false, false, false,  true, false, sc2::ABILITY_ID::MORPH_HIVE, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_INFESTATIONPIT, m_bot) }, {} };  
-
-    // Zerg Units                                                                          m  g  s  t  unit  bld    wrk    rfn    sup    hall   add
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_OVERLORD, m_bot)] =                   { sc2::Race::Zerg, 0, 0, 0, 0, true, false, false, false,  true, false, false, sc2::ABILITY_ID::TRAIN_OVERLORD, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_LARVA, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_BANELING, m_bot)] =                   { sc2::Race::Zerg, 0, 0, 0, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_BANELING, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_LARVA, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_BANELINGNEST, m_bot) }, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_CORRUPTOR, m_bot)] =                  { sc2::Race::Zerg, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_CORRUPTOR, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_LARVA, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_SPIRE, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_GREATERSPIRE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_DRONE, m_bot)] =                      { sc2::Race::Zerg, 0, 0, 1, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_DRONE, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_LARVA, m_bot) }, {}, {} }; 
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_HYDRALISK, m_bot)] =                  { sc2::Race::Zerg, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_HYDRALISK, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_LARVA, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_HYDRALISKDEN, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_LURKERDENMP, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_INFESTOR, m_bot)] =                   { sc2::Race::Zerg, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_INFESTOR, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_LARVA, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_INFESTATIONPIT, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_MUTALISK, m_bot)] =                   { sc2::Race::Zerg, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_MUTALISK, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_LARVA, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_SPIRE, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_GREATERSPIRE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_ROACH, m_bot)] =                      { sc2::Race::Zerg, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_ROACH, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_LARVA, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_ROACHWARREN, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_SWARMHOSTMP, m_bot)] =                { sc2::Race::Zerg, 0, 0, 3, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_SWARMHOST, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_LARVA, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_INFESTATIONPIT, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_ULTRALISK, m_bot)] =                  { sc2::Race::Zerg, 0, 0, 6, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_ULTRALISK, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_LARVA, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_ULTRALISKCAVERN, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_VIPER, m_bot)] =                      { sc2::Race::Zerg, 0, 0, 3, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_VIPER, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_LARVA, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_ZERGLING, m_bot)] =                   { sc2::Race::Zerg, 0, 0, 1, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_ZERGLING, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_LARVA, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_QUEEN, m_bot)] =                      { sc2::Race::Zerg, 0, 0, 2, 0, true, false, false, false, false, false, false, sc2::ABILITY_ID::TRAIN_QUEEN, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_HATCHERY, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL, m_bot) }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_LARVA, m_bot)] =                      { sc2::Race::Zerg, 0, 0, 2, 0, true, false, false, false, false, false, false, 0, 0, { UnitType() }, { UnitType() }, {} };
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_EGG, m_bot)] =                        { sc2::Race::Zerg, 0, 0, 2, 0, true, false, false, false, false, false, false, 0, 0, { UnitType() }, { UnitType() }, {} };
+    for (const auto & entry : UnitTypeTable)
+    {
+        setData(UnitType(entry.type, m_bot), MakeTypeData(entry, m_bot));
+    }
+
+    for (const auto & alias : UnitTypeAliases)
+    {
+        setData(UnitType(alias.type, m_bot), getData(UnitType(alias.sameAs, m_bot)));
+    }
 
     // Set the Mineral / Gas cost of each unit
-    for (auto & kv : m_unitTypeData)
+    const auto & unitTypeData = m_bot.Observation()->GetUnitTypeData();
+    for (size_t id(1); id < m_unitTypeIndex.size(); ++id)
     {
-        if (!kv.first.isValid()) { continue; }
-        
-        auto & data = m_bot.Observation()->GetUnitTypeData()[kv.first.getAPIUnitType()];
-                
-        kv.second.mineralCost = data.mineral_cost;
-        kv.second.gasCost     = data.vespene_cost;
+        if (m_unitTypeIndex[id] == 0 || id >= unitTypeData.size()) { continue; }
+
+        m_unitTypeData[m_unitTypeIndex[id]].mineralCost = unitTypeData[id].mineral_cost;
+        m_unitTypeData[m_unitTypeIndex[id]].gasCost     = unitTypeData[id].vespene_cost;
     }
 
     // fix the cumulative prices of morphed buildings
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot)].mineralCost -= getData(UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot)).mineralCost;
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot)].mineralCost -= getData(UnitType(sc2::UNIT_TYPEID::ZERG_HATCHERY, m_bot)).mineralCost;
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_PLANETARYFORTRESS, m_bot)].mineralCost -= getData(UnitType(sc2::UNIT_TYPEID::TERRAN_COMMANDCENTER, m_bot)).mineralCost;
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMAND, m_bot)].mineralCost -= getData(UnitType(sc2::UNIT_TYPEID::TERRAN_COMMANDCENTER, m_bot)).mineralCost;
-    m_unitTypeData[UnitType(sc2::UNIT_TYPEID::ZERG_GREATERSPIRE, m_bot)].mineralCost -= getData(UnitType(sc2::UNIT_TYPEID::ZERG_SPIRE, m_bot)).mineralCost;
+    const std::pair<sc2::UNIT_TYPEID, sc2::UNIT_TYPEID> morphs[] =
+    {
+        { sc2::UNIT_TYPEID::ZERG_HIVE,                  sc2::UNIT_TYPEID::ZERG_LAIR },
+        { sc2::UNIT_TYPEID::ZERG_LAIR,                  sc2::UNIT_TYPEID::ZERG_HATCHERY },
+        { sc2::UNIT_TYPEID::TERRAN_PLANETARYFORTRESS,   sc2::UNIT_TYPEID::TERRAN_COMMANDCENTER },
+        { sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMAND,      sc2::UNIT_TYPEID::TERRAN_COMMANDCENTER },
+        { sc2::UNIT_TYPEID::ZERG_GREATERSPIRE,          sc2::UNIT_TYPEID::ZERG_SPIRE },
+    };
+
+    for (const auto & morph : morphs)
+    {
+        const int fromCost = getData(UnitType(morph.second, m_bot)).mineralCost;
+        m_unitTypeData[m_unitTypeIndex[UnitType(morph.first, m_bot).getIndex()]].mineralCost -= fromCost;
+    }
 }
 
 void TechTree::initUpgradeData()
 {
-    // 0 data for null / error return
-    m_upgradeData[0] = TypeData();
-
-    // Terran Upgrades
-    m_upgradeData[sc2::UPGRADE_ID::BANSHEECLOAK] =                      { sc2::Race::Terran, 100, 100, 0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_BANSHEECLOAKINGFIELD, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::BANSHEESPEED] =                      { sc2::Race::Terran, 200, 200, 0, 2720, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_BANSHEEHYPERFLIGHTROTORS, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::BATTLECRUISERENABLESPECIALIZATIONS]= { sc2::Race::Terran, 150, 150, 0,  960, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_BATTLECRUISERWEAPONREFIT, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::DRILLCLAWS] =                        { sc2::Race::Terran, 150, 150, 0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_DRILLINGCLAWS, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORYTECHLAB, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::HIGHCAPACITYBARRELS] =               { sc2::Race::Terran, 150, 150, 0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_INFERNALPREIGNITER, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::HISECAUTOTRACKING] =                 { sc2::Race::Terran, 100, 100, 0, 1280, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_HISECAUTOTRACKING, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::LIBERATORAGRANGEUPGRADE] =           { sc2::Race::Terran, 150, 150, 0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ADVANCEDBALLISTICS, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_STARPORTTECHLAB, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::MAGFIELDLAUNCHERS] =                 { sc2::Race::Terran, 100, 100, 0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_MAGFIELDLAUNCHERS, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_FACTORYTECHLAB, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::MEDIVACINCREASESPEEDBOOST] =         { sc2::Race::Terran, 100, 100, 0, 1280, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_HIGHCAPACITYFUELTANKS, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::NEOSTEELFRAME] =                     { sc2::Race::Terran, 100, 100, 0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_NEOSTEELFRAME, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::PERSONALCLOAKING] =                  { sc2::Race::Terran, 150, 150, 0, 1920, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PERSONALCLOAKING, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_GHOSTACADEMY, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::PUNISHERGRENADES] =                  { sc2::Race::Terran,  50,  50, 0,  960, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_CONCUSSIVESHELLS, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKSTECHLAB, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::RAVENCORVIDREACTOR] =                { sc2::Race::Terran, 150, 150, 0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_RAVENCORVIDREACTOR, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::RAVENRECALIBRATEDEXPLOSIVES] =       { sc2::Race::Terran, 150, 150, 0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_RAVENRECALIBRATEDEXPLOSIVES, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_SCV, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::SHIELDWALL] =                        { sc2::Race::Terran, 100, 100, 0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_COMBATSHIELD, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKSTECHLAB, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::STIMPACK] =                          { sc2::Race::Terran, 100, 100, 0, 2720, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_STIMPACK, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_BARRACKSTECHLAB, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::TERRANBUILDINGARMOR] =               { sc2::Race::Terran, 150, 150, 0, 2240, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANSTRUCTUREARMORUPGRADE, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::TERRANINFANTRYARMORSLEVEL1] =        { sc2::Race::Terran, 100, 100, 0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANINFANTRYARMOR, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::TERRANINFANTRYARMORSLEVEL2] =        { sc2::Race::Terran, 175, 175, 0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANINFANTRYARMOR, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_ARMORY, m_bot) }, {sc2::UPGRADE_ID::TERRANINFANTRYARMORSLEVEL1} };
-    m_upgradeData[sc2::UPGRADE_ID::TERRANINFANTRYARMORSLEVEL3] =        { sc2::Race::Terran, 250, 250, 0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANINFANTRYARMOR, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_ARMORY, m_bot) }, {sc2::UPGRADE_ID::TERRANINFANTRYARMORSLEVEL2} };
-    m_upgradeData[sc2::UPGRADE_ID::TERRANINFANTRYWEAPONSLEVEL1] =       { sc2::Race::Terran, 100, 100, 0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANINFANTRYWEAPONS, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY, m_bot) }, {}, {} };	//custom edited ability to properly research armor/inf upg
-    m_upgradeData[sc2::UPGRADE_ID::TERRANINFANTRYWEAPONSLEVEL2] =       { sc2::Race::Terran, 175, 175, 0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANINFANTRYWEAPONS, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_ARMORY, m_bot) }, {sc2::UPGRADE_ID::TERRANINFANTRYWEAPONSLEVEL1} };
-    m_upgradeData[sc2::UPGRADE_ID::TERRANINFANTRYWEAPONSLEVEL3] =       { sc2::Race::Terran, 250, 250, 0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANINFANTRYWEAPONS, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY, m_bot) }, { UnitType(sc2::UNIT_TYPEID::TERRAN_ARMORY, m_bot) }, {sc2::UPGRADE_ID::TERRANINFANTRYWEAPONSLEVEL2} };
-    m_upgradeData[sc2::UPGRADE_ID::TERRANSHIPWEAPONSLEVEL1] =           { sc2::Race::Terran, 100, 100, 0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANSHIPWEAPONS, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ARMORY, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::TERRANSHIPWEAPONSLEVEL2] =           { sc2::Race::Terran, 175, 175, 0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANSHIPWEAPONS, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ARMORY, m_bot) }, {}, {sc2::UPGRADE_ID::TERRANSHIPWEAPONSLEVEL1} };
-    m_upgradeData[sc2::UPGRADE_ID::TERRANSHIPWEAPONSLEVEL3] =           { sc2::Race::Terran, 250, 250, 0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANSHIPWEAPONS, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ARMORY, m_bot) }, {}, {sc2::UPGRADE_ID::TERRANSHIPWEAPONSLEVEL2} };
-    m_upgradeData[sc2::UPGRADE_ID::TERRANVEHICLEANDSHIPARMORSLEVEL1] =  { sc2::Race::Terran, 100, 100, 0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANVEHICLEANDSHIPPLATING, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ARMORY, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::TERRANVEHICLEANDSHIPARMORSLEVEL2] =  { sc2::Race::Terran, 175, 175, 0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANVEHICLEANDSHIPPLATING, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ARMORY, m_bot) }, {}, {sc2::UPGRADE_ID::TERRANVEHICLEANDSHIPARMORSLEVEL1} };
-    m_upgradeData[sc2::UPGRADE_ID::TERRANVEHICLEANDSHIPARMORSLEVEL3] =  { sc2::Race::Terran, 250, 250, 0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANVEHICLEANDSHIPPLATING, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ARMORY, m_bot) }, {}, {sc2::UPGRADE_ID::TERRANVEHICLEANDSHIPARMORSLEVEL2} };
-    m_upgradeData[sc2::UPGRADE_ID::TERRANVEHICLEWEAPONSLEVEL1] =        { sc2::Race::Terran, 100, 100, 0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANVEHICLEWEAPONS, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ARMORY, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::TERRANVEHICLEWEAPONSLEVEL2] =        { sc2::Race::Terran, 175, 175, 0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANVEHICLEWEAPONS, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ARMORY, m_bot) }, {}, {sc2::UPGRADE_ID::TERRANVEHICLEWEAPONSLEVEL1} };
-    m_upgradeData[sc2::UPGRADE_ID::TERRANVEHICLEWEAPONSLEVEL3] =        { sc2::Race::Terran, 250, 250, 0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TERRANVEHICLEWEAPONS, 0, { UnitType(sc2::UNIT_TYPEID::TERRAN_ARMORY, m_bot) }, {}, {sc2::UPGRADE_ID::TERRANVEHICLEWEAPONSLEVEL2} };
-
-    // Protoss Upgrades
-    m_upgradeData[sc2::UPGRADE_ID::ADEPTPIERCINGATTACK] =               { sc2::Race::Protoss, 100, 100, 0, 2240, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ADEPTRESONATINGGLAIVES, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::BLINKTECH] =                         { sc2::Race::Protoss, 150, 150, 0, 2720, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_BLINK, 0,                   { UnitType(sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::CARRIERLAUNCHSPEEDUPGRADE] =         { sc2::Race::Protoss, 150, 150, 0, 1280, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_INTERCEPTORGRAVITONCATAPULT, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::CHARGE] =                            { sc2::Race::Protoss, 100, 100, 0, 2240, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_CHARGE, 0,                  { UnitType(sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::DARKTEMPLARBLINKUPGRADE] =           { sc2::Race::Protoss, 100, 100, 0, 2720, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_SHADOWSTRIKE, 0,            { UnitType(sc2::UNIT_TYPEID::PROTOSS_DARKSHRINE, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::EXTENDEDTHERMALLANCE] =              { sc2::Race::Protoss, 200, 200, 0, 2240, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_EXTENDEDTHERMALLANCE, 0,    { UnitType(sc2::UNIT_TYPEID::PROTOSS_ROBOTICSBAY, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::GRAVITICDRIVE] =                     { sc2::Race::Protoss, 100, 100, 0, 1280, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_GRAVITICDRIVE, 0,           { UnitType(sc2::UNIT_TYPEID::PROTOSS_ROBOTICSBAY, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::OBSERVERGRAVITICBOOSTER] =           { sc2::Race::Protoss, 100, 100, 0, 1280, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_GRAVITICBOOSTER, 0,         { UnitType(sc2::UNIT_TYPEID::PROTOSS_ROBOTICSBAY, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::PHOENIXRANGEUPGRADE] =               { sc2::Race::Protoss, 150, 150, 0, 1440, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PHOENIXANIONPULSECRYSTALS, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::PROTOSSAIRARMORSLEVEL1] =            { sc2::Race::Protoss, 150, 150, 0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSAIRARMORLEVEL1, 0,   { UnitType(sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::PROTOSSAIRARMORSLEVEL2] =            { sc2::Race::Protoss, 225, 225, 0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSAIRARMORLEVEL2, 0,   { UnitType(sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON, m_bot) }, {sc2::UPGRADE_ID::PROTOSSAIRARMORSLEVEL1} };
-    m_upgradeData[sc2::UPGRADE_ID::PROTOSSAIRARMORSLEVEL3] =            { sc2::Race::Protoss, 300, 300, 0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSAIRARMORLEVEL3, 0,   { UnitType(sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON, m_bot) }, {sc2::UPGRADE_ID::PROTOSSAIRARMORSLEVEL2} };
-    m_upgradeData[sc2::UPGRADE_ID::PROTOSSAIRWEAPONSLEVEL1] =           { sc2::Race::Protoss, 100, 100, 0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSAIRWEAPONSLEVEL1, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::PROTOSSAIRWEAPONSLEVEL2] =           { sc2::Race::Protoss, 175, 175, 0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSAIRWEAPONSLEVEL2, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON, m_bot) }, {sc2::UPGRADE_ID::PROTOSSAIRWEAPONSLEVEL1} };
-    m_upgradeData[sc2::UPGRADE_ID::PROTOSSAIRWEAPONSLEVEL3] =           { sc2::Race::Protoss, 250, 250, 0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSAIRWEAPONSLEVEL3, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FLEETBEACON, m_bot) }, {sc2::UPGRADE_ID::PROTOSSAIRWEAPONSLEVEL3} };
-    m_upgradeData[sc2::UPGRADE_ID::PROTOSSGROUNDARMORSLEVEL1] =         { sc2::Race::Protoss, 100, 100, 0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSGROUNDARMORLEVEL1, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FORGE, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::PROTOSSGROUNDARMORSLEVEL2] =         { sc2::Race::Protoss, 150, 150, 0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSGROUNDARMORLEVEL2, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FORGE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL, m_bot) }, { sc2::UPGRADE_ID::PROTOSSGROUNDARMORSLEVEL1 } };
-    m_upgradeData[sc2::UPGRADE_ID::PROTOSSGROUNDARMORSLEVEL3] =         { sc2::Race::Protoss, 200, 200, 0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSGROUNDARMORLEVEL3, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FORGE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL, m_bot) }, { sc2::UPGRADE_ID::PROTOSSGROUNDARMORSLEVEL2 } };
-    m_upgradeData[sc2::UPGRADE_ID::PROTOSSGROUNDWEAPONSLEVEL1] =        { sc2::Race::Protoss, 100, 100, 0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSGROUNDWEAPONSLEVEL1, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FORGE, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::PROTOSSGROUNDWEAPONSLEVEL2] =        { sc2::Race::Protoss, 150, 150, 0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSGROUNDWEAPONSLEVEL2, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FORGE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL, m_bot) }, { sc2::UPGRADE_ID::PROTOSSGROUNDWEAPONSLEVEL1 } };
-    m_upgradeData[sc2::UPGRADE_ID::PROTOSSGROUNDWEAPONSLEVEL3] =        { sc2::Race::Protoss, 200, 200, 0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSGROUNDWEAPONSLEVEL3, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FORGE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL, m_bot) }, { sc2::UPGRADE_ID::PROTOSSGROUNDWEAPONSLEVEL2 } };
-    m_upgradeData[sc2::UPGRADE_ID::PROTOSSSHIELDSLEVEL1] =              { sc2::Race::Protoss, 150, 150, 0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSSHIELDSLEVEL1, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FORGE, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::PROTOSSSHIELDSLEVEL2] =              { sc2::Race::Protoss, 225, 225, 0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSSHIELDSLEVEL2, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FORGE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL, m_bot) }, { sc2::UPGRADE_ID::PROTOSSSHIELDSLEVEL1 } };
-    m_upgradeData[sc2::UPGRADE_ID::PROTOSSSHIELDSLEVEL3] =              { sc2::Race::Protoss, 300, 300, 0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PROTOSSSHIELDSLEVEL3, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_FORGE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::PROTOSS_TWILIGHTCOUNCIL, m_bot) }, { sc2::UPGRADE_ID::PROTOSSSHIELDSLEVEL2} };
-    m_upgradeData[sc2::UPGRADE_ID::PSISTORMTECH] =                      { sc2::Race::Protoss, 200, 200, 0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PSISTORM, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_TEMPLARARCHIVE, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::WARPGATERESEARCH] =                  { sc2::Race::Protoss,  50,  50, 0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_WARPGATE, 0, { UnitType(sc2::UNIT_TYPEID::PROTOSS_CYBERNETICSCORE, m_bot) }, {}, {} };
-
-    // Zerg Upgrades
-    m_upgradeData[sc2::UPGRADE_ID::BURROW] =                            { sc2::Race::Zerg, 100, 100, 0, 1600, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_BURROW, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_HATCHERY, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::CENTRIFICALHOOKS] =                  { sc2::Race::Zerg, 150, 150, 0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_CENTRIFUGALHOOKS, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_BANELINGNEST, m_bot) }, {}, {} }; 
-    m_upgradeData[sc2::UPGRADE_ID::CHITINOUSPLATING] =                  { sc2::Race::Zerg, 150, 150, 0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_CHITINOUSPLATING, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_ULTRALISKCAVERN, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::EVOLVEGROOVEDSPINES] =               { sc2::Race::Zerg, 150, 150, 0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_GROOVEDSPINES, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_HYDRALISKDEN, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::EVOLVEMUSCULARAUGMENTS] =            { sc2::Race::Zerg, 150, 150, 0, 1600, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_MUSCULARAUGMENTS, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_HYDRALISKDEN, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::GLIALRECONSTITUTION] =               { sc2::Race::Zerg, 100, 100, 0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_GLIALREGENERATION, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_ROACHWARREN, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {} };
-    m_upgradeData[sc2::UPGRADE_ID::INFESTORENERGYUPGRADE] =             { sc2::Race::Zerg, 150, 150, 0, 1280, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PATHOGENGLANDS, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_INFESTATIONPIT, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::NEURALPARASITE] =                    { sc2::Race::Zerg, 150, 150, 0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_NEURALPARASITE, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_INFESTATIONPIT, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::OVERLORDSPEED] =                     { sc2::Race::Zerg, 100, 100, 0,  960, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_PNEUMATIZEDCARAPACE, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_HATCHERY, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {}, {} };                       
-    m_upgradeData[sc2::UPGRADE_ID::TUNNELINGCLAWS] =                    { sc2::Race::Zerg, 150, 150, 0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_TUNNELINGCLAWS, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_ROACHWARREN, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {} };
-    m_upgradeData[sc2::UPGRADE_ID::ZERGFLYERARMORSLEVEL1] =             { sc2::Race::Zerg, 150, 150, 0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGFLYERARMORLEVEL1, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_SPIRE, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_GREATERSPIRE, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::ZERGFLYERARMORSLEVEL2] =             { sc2::Race::Zerg, 225, 225, 0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGFLYERARMORLEVEL2, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_SPIRE, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_GREATERSPIRE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, { sc2::UPGRADE_ID::ZERGFLYERARMORSLEVEL1 } };
-    m_upgradeData[sc2::UPGRADE_ID::ZERGFLYERARMORSLEVEL3] =             { sc2::Race::Zerg, 300, 300, 0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGFLYERARMORLEVEL3, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_SPIRE, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_GREATERSPIRE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, { sc2::UPGRADE_ID::ZERGFLYERARMORSLEVEL2 } };
-    m_upgradeData[sc2::UPGRADE_ID::ZERGFLYERWEAPONSLEVEL1] =            { sc2::Race::Zerg, 100, 100, 0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGFLYERATTACKLEVEL1, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_SPIRE, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_GREATERSPIRE, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::ZERGFLYERWEAPONSLEVEL2] =            { sc2::Race::Zerg, 175, 175, 0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGFLYERATTACKLEVEL2, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_SPIRE, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_GREATERSPIRE, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, { sc2::UPGRADE_ID::ZERGFLYERWEAPONSLEVEL1 } };
-    m_upgradeData[sc2::UPGRADE_ID::ZERGFLYERWEAPONSLEVEL3] =            { sc2::Race::Zerg, 250, 250, 0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGFLYERATTACKLEVEL3, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_SPIRE, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_GREATERSPIRE, m_bot) }, {UnitType( sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, { sc2::UPGRADE_ID::ZERGFLYERWEAPONSLEVEL2 } };
-    m_upgradeData[sc2::UPGRADE_ID::ZERGGROUNDARMORSLEVEL1] =            { sc2::Race::Zerg, 150, 150, 0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGGROUNDARMORLEVEL1, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::ZERGGROUNDARMORSLEVEL2] =            { sc2::Race::Zerg, 225, 225, 0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGGROUNDARMORLEVEL2, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {sc2::UPGRADE_ID::ZERGGROUNDARMORSLEVEL1} };
-    m_upgradeData[sc2::UPGRADE_ID::ZERGGROUNDARMORSLEVEL3] =            { sc2::Race::Zerg, 300, 300, 0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGGROUNDARMORLEVEL3, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {sc2::UPGRADE_ID::ZERGGROUNDARMORSLEVEL2} };
-    m_upgradeData[sc2::UPGRADE_ID::ZERGLINGATTACKSPEED] =               { sc2::Race::Zerg, 200, 200, 0, 2080, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGLINGADRENALGLANDS, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {} };
-    m_upgradeData[sc2::UPGRADE_ID::ZERGLINGMOVEMENTSPEED] =             { sc2::Race::Zerg, 100, 100, 0, 1760, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGLINGMETABOLICBOOST, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_SPAWNINGPOOL, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::ZERGMELEEWEAPONSLEVEL1] =            { sc2::Race::Zerg, 100, 100, 0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGMELEEWEAPONSLEVEL1, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::ZERGMELEEWEAPONSLEVEL2] =            { sc2::Race::Zerg, 150, 150, 0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGMELEEWEAPONSLEVEL2, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {sc2::UPGRADE_ID::ZERGMELEEWEAPONSLEVEL1} };
-    m_upgradeData[sc2::UPGRADE_ID::ZERGMELEEWEAPONSLEVEL3] =            { sc2::Race::Zerg, 200, 200, 0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGMELEEWEAPONSLEVEL3, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {sc2::UPGRADE_ID::ZERGMELEEWEAPONSLEVEL2} };
-    m_upgradeData[sc2::UPGRADE_ID::ZERGMISSILEWEAPONSLEVEL1] =          { sc2::Race::Zerg, 100, 100, 0, 2560, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGMISSILEWEAPONSLEVEL1, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER, m_bot) }, {}, {} };
-    m_upgradeData[sc2::UPGRADE_ID::ZERGMISSILEWEAPONSLEVEL2] =          { sc2::Race::Zerg, 150, 150, 0, 3040, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGMISSILEWEAPONSLEVEL2, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_LAIR, m_bot), UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {sc2::UPGRADE_ID::ZERGMISSILEWEAPONSLEVEL1} };
-    m_upgradeData[sc2::UPGRADE_ID::ZERGMISSILEWEAPONSLEVEL3] =          { sc2::Race::Zerg, 200, 200, 0, 3520, false, false, false, false, false, false, false, sc2::ABILITY_ID::RESEARCH_ZERGMISSILEWEAPONSLEVEL3, 0, { UnitType(sc2::UNIT_TYPEID::ZERG_EVOLUTIONCHAMBER, m_bot) }, { UnitType(sc2::UNIT_TYPEID::ZERG_HIVE, m_bot) }, {sc2::UPGRADE_ID::ZERGMISSILEWEAPONSLEVEL2} };
+    for (const auto & entry : UpgradeTable)
+    {
+        setData(entry.type, MakeTypeData(entry, m_bot));
+    }
 }
 #else
 void TechTree::initUpgradeData()
 {
-    
-    m_unitTypeData[UnitType(BWAPI::UnitTypes::None, m_bot)] = TypeData();
-
     for (auto & type : BWAPI::UnitTypes::allUnitTypes())
     {
         TypeData typeData;
@@ -301,7 +403,7 @@ void TechTree::initUpgradeData()
         }
         typeData.requiredUnits = requiredUnits;
 
-        m_unitTypeData[UnitType(type, m_bot)] = typeData;
+        setData(UnitType(type, m_bot), typeData);
     }
 }
 
@@ -311,26 +413,55 @@ void TechTree::initUnitTypeData()
 }
 #endif
 
-const TypeData & TechTree::getData(const UnitType & type) const
+void TechTree::setData(const UnitType & type, const TypeData & data)
 {
-    if (m_unitTypeData.find(type) == m_unitTypeData.end())
-    {
-        //std::cout << "WARNING: Unit type not found: " << type.getName() << "\n";
-        return m_unitTypeData.begin()->second;
-    }
+    setData(m_unitTypeData, m_unitTypeIndex, type.getIndex(), data);
+}
 
-    return m_unitTypeData.at(type);
+void TechTree::setData(const CCUpgrade & type, const TypeData & data)
+{
+    setData(m_upgradeData, m_upgradeIndex, GetUpgradeIndex(type), data);
 }
 
-const TypeData & TechTree::getData(const CCUpgrade & type)  const
+void TechTree::setData(std::vector<TypeData> & allData, std::vector<uint16_t> & index, size_t id, const TypeData & data)
 {
-    if (m_upgradeData.find(type) == m_upgradeData.end())
+    if (id >= index.size())
     {
-        //std::cout << "WARNING: Upgrade not found: " << sc2::UpgradeIDToName(type) << "\n";
-        return m_unitTypeData.begin()->second;
+        index.resize(id + 1, 0);
     }
 
-    return m_upgradeData.at(type);
+    // setting a type twice replaces its data, the same as the maps this table replaced
+    if (index[id] == 0)
+    {
+        BOT_ASSERT(allData.size() < std::numeric_limits<uint16_t>::max(), "Too many tech tree types");
+        index[id] = (uint16_t)allData.size();
+        allData.push_back(data);
+    }
+    else
+    {
+        allData[index[id]] = data;
+    }
+}
+
+size_t TechTree::GetUpgradeIndex(const CCUpgrade & type)
+{
+#ifdef SC2API
+    return (size_t)(uint32_t)type;
+#else
+    return (size_t)type.getID();
+#endif
+}
+
+const TypeData & TechTree::getData(const UnitType & type) const
+{
+    const size_t id = type.getIndex();
+    return id < m_unitTypeIndex.size() ? m_unitTypeData[m_unitTypeIndex[id]] : m_unitTypeData[0];
+}
+
+const TypeData & TechTree::getData(const CCUpgrade & type)  const
+{
+    const size_t id = GetUpgradeIndex(type);
+    return id < m_upgradeIndex.size() ? m_upgradeData[m_upgradeIndex[id]] : m_upgradeData[0];
 }
 
 const TypeData & TechTree::getData(const MetaType & type) const
@@ -349,65 +480,5 @@ const TypeData & TechTree::getData(const MetaType & type) const
     
     BOT_ASSERT(false, "Can't getData this type: %s", type.getName().c_str());
 
-    return m_unitTypeData.begin()->second;
-}
-
-void TechTree::outputJSON(const std::string & filename) const
-{
-#ifdef SC2APIXXX
-    std::ofstream out(filename);
-    out << "{\n";
-    std::string q = "\"";
-    std::string qcs = "\", ";
-
-    std::vector<std::pair<int, UnitTypeData>> allData;
-    for (auto & kv : m_unitTypeData) { allData.push_back({kv.first, kv.second}); }
-    for (auto & kv : m_upgradeData) { allData.push_back({kv.first, kv.second}); }
-
-    for (auto & kv : allData)
-    {
-        std::string name( kv.second.isUnit ? m_bot.Observation()->GetUnitTypeData()[kv.first].name : m_bot.Observation()->GetUpgradeData()[kv.first].name);
-        if (name.find("Flying") != std::string::npos) { continue; }
-        if (name.find("Lowered") != std::string::npos) { continue; }
-
-        auto & data = kv.second;
-               
-        out << "    [";
-        out << q << name << qcs;
-        out << q << Util::GetStringFromRace(data.race) << qcs;
-        out << data.mineralCost << ", " << data.gasCost << ", " << data.supplyCost << ", " << data.buildTime << ", ";
-        out << data.isUnit << ", " << data.isBuilding << ", " << data.isWorker<< ", " << data.isSupplyDepot << ", " << data.isTownHall << ", " << data.isAddon << ", ";
-
-        out << "[";
-        for (size_t i(0); i < data.whatBuilds.size(); ++i) 
-        { 
-            out << q << m_bot.Observation()->GetUnitTypeData()[data.whatBuilds[i].getAPIUnitType()].name << q;
-            if (i < data.whatBuilds.size() - 1) { out << ", "; }
-        }
-        out << "], ";
-
-        out << "[";
-        for (size_t i(0); i < data.requiredUnits.size(); ++i) 
-        { 
-            out << q << m_bot.Observation()->GetUnitTypeData()[data.requiredUnits[i].getAPIUnitType()].name << q;
-            if (i < data.requiredUnits.size() - 1) { out << ", "; }
-        }
-        out << "], ";
-
-        out << "[";
-        for (size_t i(0); i < data.requiredUpgrades.size(); ++i) 
-        { 
-            out << q << m_bot.Observation()->GetUpgradeData()[data.requiredUpgrades[i]].name << q;
-            if (i < data.requiredUpgrades.size() - 1) { out << ", "; }
-        }
-        out << "] ";
-
-        out << "],\n";
-    }
-
-    out << "}";
-    out.close();
-#else
-
-#endif
+    return m_unitTypeData[0];
 }
@@ -29,16 +29,26 @@ struct TypeData
     std::vector<CCUpgrade>  requiredUpgrades; // having ALL of these is required to make
 };
 
+// Static data for every unit type and upgrade the bot knows how to make
+// the data is filled once in onStart from the constant tables in TechTree.cpp and stored densely,
+// with an index from the API's numeric type id to the data, so getData is two array loads.
+// entry 0 of each data array is the empty data returned for types that are not in the tables
 class TechTree
 {
-    CCBot & m_bot;
-    std::map<UnitType, TypeData>  m_unitTypeData;
-    std::map<CCUpgrade, TypeData> m_upgradeData;
+    CCBot &                 m_bot;
+    std::vector<TypeData>   m_unitTypeData;
+    std::vector<uint16_t>   m_unitTypeIndex;    // unit type id to its entry in m_unitTypeData, 0 if it has none
+    std::vector<TypeData>   m_upgradeData;
+    std::vector<uint16_t>   m_upgradeIndex;     // upgrade id to its entry in m_upgradeData, 0 if it has none
 
     void initUnitTypeData();
     void initUpgradeData();
 
-    void outputJSON(const std::string & filename) const;
+    void setData(const UnitType & type, const TypeData & data);
+    void setData(const CCUpgrade & type, const TypeData & data);
+    void setData(std::vector<TypeData> & allData, std::vector<uint16_t> & index, size_t id, const TypeData & data);
+
+    static size_t GetUpgradeIndex(const CCUpgrade & type);
 
 public:
 
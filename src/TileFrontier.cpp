@@ -0,0 +1,106 @@
+#include "TileFrontier.h"
+#include "WalkabilityMask.h"
+#include <algorithm>
+
+TileFrontierBuffers & TileFrontierPool::acquire(int width, int height)
+{
+    if (m_free.empty())
+    {
+        m_buffers.emplace_back();
+        m_free.push_back(&m_buffers.back());
+    }
+
+    TileFrontierBuffers & buffers = *m_free.back();
+    m_free.pop_back();
+
+    if (buffers.visited.width() != width || buffers.visited.height() != height)
+    {
+        buffers.visited.reset(width, height, 0);
+        buffers.stamp = 0;
+    }
+
+    // a wrapped stamp could match a tile left over from an old search, so start the stamps over
+    if (++buffers.stamp == 0)
+    {
+        buffers.visited.fill(0);
+        buffers.stamp = 1;
+    }
+
+    buffers.ring.clear();
+    buffers.nextRing.clear();
+    return buffers;
+}
+
+void TileFrontierPool::release(TileFrontierBuffers & buffers)
+{
+    m_free.push_back(&buffers);
+}
+
+TileFrontier::TileFrontier(const WalkabilityMask & mask, TileFrontierPool & pool, const CCTilePosition & start)
+    : m_mask    (mask)
+    , m_pool    (pool)
+    , m_buffers (pool.acquire(mask.width(), mask.height()))
+    , m_next    (0)
+    , m_distance(0)
+{
+    if (m_buffers.visited.isValid(start.x, start.y))
+    {
+        m_buffers.visited(start.x, start.y) = m_buffers.stamp;
+        m_buffers.ring.push_back(start);
+    }
+}
+
+TileFrontier::~TileFrontier()
+{
+    m_pool.release(m_buffers);
+}
+
+void TileFrontier::visit(int x, int y)
+{
+    if (!m_mask.isWalkable(x, y) || m_buffers.visited(x, y) == m_buffers.stamp)
+    {
+        return;
+    }
+
+    m_buffers.visited(x, y) = m_buffers.stamp;
+    m_buffers.nextRing.push_back(CCTilePosition(x, y));
+}
+
+bool TileFrontier::expandRing()
+{
+    m_buffers.nextRing.clear();
+    for (auto & tile : m_buffers.ring)
+    {
+        visit(tile.x - 1, tile.y);
+        visit(tile.x + 1, tile.y);
+        visit(tile.x, tile.y - 1);
+        visit(tile.x, tile.y + 1);
+    }
+
+    // DistanceMap orders tiles of equal distance row by row, so placement searches pick the same tile either way
+    std::sort(m_buffers.nextRing.begin(), m_buffers.nextRing.end(), [](const CCTilePosition & a, const CCTilePosition & b)
+    {
+        return a.y < b.y || (a.y == b.y && a.x < b.x);
+    });
+
+    std::swap(m_buffers.ring, m_buffers.nextRing);
+    m_next = 0;
+    m_distance++;
+    return !m_buffers.ring.empty();
+}
+
+bool TileFrontier::next(CCTilePosition & tile)
+{
+    if (m_next >= m_buffers.ring.size() && (m_buffers.ring.empty() || !expandRing()))
+    {
+        return false;
+    }
+
+    tile = m_buffers.ring[m_next++];
+    return true;
+}
+
+int TileFrontier::distance() const
+{
+    return m_distance;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Common.h"
+#include "Grid2D.h"
+#include <deque>
+
+class WalkabilityMask;
+
+// Scratch space a TileFrontier borrows for the length of its search
+// visited holds the stamp of the last search that reached each tile, so a new search never clears it
+struct TileFrontierBuffers
+{
+    Grid2D<uint32_t>            visited;
+    uint32_t                    stamp;
+    std::vector<CCTilePosition> ring;
+    std::vector<CCTilePosition> nextRing;
+
+    TileFrontierBuffers() : stamp(0) { }
+};
+
+// Buffers are handed out by MapTools and returned when a search ends, so repeated searches do not allocate
+// a deque keeps handed out buffers in place as the pool grows for searches that run inside other searches
+class TileFrontierPool
+{
+    std::deque<TileFrontierBuffers>     m_buffers;
+    std::vector<TileFrontierBuffers *>  m_free;
+
+public:
+
+    TileFrontierBuffers &   acquire(int width, int height);
+    void                    release(TileFrontierBuffers & buffers);
+};
+
+// Resumable breadth first search over walkable tiles, yielding tiles in the same order as DistanceMap::getSortedTiles
+// each ring of equal distance is only expanded once the consumer has pulled every tile of the ring before it,
+// so a search that stops after a few dozen tiles never touches the rest of the map
+// as with DistanceMap the start tile always comes first, walkable or not
+class TileFrontier
+{
+    const WalkabilityMask &     m_mask;
+    TileFrontierPool &          m_pool;
+    TileFrontierBuffers &       m_buffers;
+    size_t                      m_next;         // index in the current ring of the next tile to yield
+    int                         m_distance;     // distance of the current ring
+
+    TileFrontier(const TileFrontier &);
+    TileFrontier & operator = (const TileFrontier &);
+
+    void    visit(int x, int y);
+    bool    expandRing();
+
+public:
+
+    TileFrontier(const WalkabilityMask & mask, TileFrontierPool & pool, const CCTilePosition & start);
+    ~TileFrontier();
+
+    // sets tile to the next closest tile, false once every reachable tile has been yielded
+    bool    next(CCTilePosition & tile);
+
+    // ground distance from the start to the tile the last call to next yielded
+    int     distance() const;
+
+    // pulls up to maxTiles tiles and stops at the first one pred accepts
+    template <class Pred>
+    bool    find(size_t maxTiles, Pred pred, CCTilePosition & found);
+};
+
+template <class Pred>
+bool TileFrontier::find(size_t maxTiles, Pred pred, CCTilePosition & found)
+{
+    CCTilePosition tile;
+    for (size_t i(0); i < maxTiles && next(tile); ++i)
+    {
+        if (pred(tile))
+        {
+            found = tile;
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -4,43 +4,20 @@
 #include <thread>
 #include <chrono>
 
-#ifdef WIN32   // Windows system specific
-	#include <windows.h>
-#else          // Unix based system specific
-	#include <sys/time.h>
-#endif
-
+// measures wall time on the monotonic steady clock, so it is unaffected by system clock adjustments
 class Timer
 {
- 	double startTimeInMicroSec;                 // starting time in micro-second
-    double endTimeInMicroSec;                   // ending time in micro-second
+    typedef std::chrono::steady_clock Clock;
+
+    Clock::time_point startCount;               // time the timer was started
+    Clock::time_point endCount;                 // time the timer was stopped
     int    stopped;                             // stop flag 
-	#ifdef WIN32
-		LARGE_INTEGER frequency;                    // ticks per second
-		LARGE_INTEGER startCount;                   //
-		LARGE_INTEGER endCount;                     //
-	#else
-		timeval startCount;                         //
-		timeval endCount;                           //
-	#endif
 
 public:
 
 	Timer()
 	{
-		#ifdef WIN32
-			QueryPerformanceFrequency(&frequency);
-			startCount.QuadPart = 0;
-			endCount.QuadPart = 0;
-		#else
-			startCount.tv_sec = startCount.tv_usec = 0;
-			endCount.tv_sec = endCount.tv_usec = 0;
-		#endif
-
 		stopped = 0;
-		startTimeInMicroSec = 0;
-		endTimeInMicroSec = 0;
-		
 		start();
 	}
 	
@@ -49,42 +26,21 @@ public:
     void start()
 	{
 		stopped = 0; // reset stop flag
-		
-		#ifdef WIN32
-			QueryPerformanceCounter(&startCount);
-		#else
-			gettimeofday(&startCount, NULL);
-		#endif
+		startCount = Clock::now();
 	}
 	
     void stop()
 	{
 		stopped = 1; // set timer stopped flag
-
-		#ifdef WIN32
-			QueryPerformanceCounter(&endCount);
-		#else
-			gettimeofday(&endCount, NULL);
-		#endif
+		endCount = Clock::now();
 	}
 	
     double getElapsedTimeInMicroSec()
 	{
-		#ifdef WIN32
-			if(!stopped)
-				QueryPerformanceCounter(&endCount);
-
-			startTimeInMicroSec = startCount.QuadPart * (1000000.0 / frequency.QuadPart);
-			endTimeInMicroSec = endCount.QuadPart * (1000000.0 / frequency.QuadPart);
-		#else
-			if(!stopped)
-				gettimeofday(&endCount, NULL);
-
-			startTimeInMicroSec = (startCount.tv_sec * 1000000.0) + startCount.tv_usec;
-			endTimeInMicroSec = (endCount.tv_sec * 1000000.0) + endCount.tv_usec;
-		#endif
+		if(!stopped)
+			endCount = Clock::now();
 
-		return endTimeInMicroSec - startTimeInMicroSec;
+		return std::chrono::duration<double, std::micro>(endCount - startCount).count();
 	}
 	 
 	double getElapsedTimeInMilliSec()
@@ -1,87 +1,127 @@
 #include "Unit.h"
+#include "UnitSnapshot.h"
 #include "CCBot.h"
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable<Unit>::value, "Unit is copied by value everywhere, it must stay a plain handle");
+static_assert(sizeof(Unit) <= 16, "Unit is copied by value everywhere, it must stay a plain handle");
+
+CCBot *              Unit::s_bot        = nullptr;
+const UnitSnapshot * Unit::s_snapshot   = nullptr;
+
+#ifdef SC2API
+const CCUnitID Unit::InvalidID = sc2::NullTag;
+#else
+const CCUnitID Unit::InvalidID = -1;
+#endif
+
+void Unit::Bind(CCBot & bot, const UnitSnapshot & snapshot)
+{
+    s_bot = &bot;
+    s_snapshot = &snapshot;
+}
 
 Unit::Unit()
-    : m_bot(nullptr)
-    , m_unit(nullptr)
-    , m_unitID(0)
+    : m_unitID(InvalidID)
+    , m_slot(UnitSnapshot::InvalidSlot)
+{
+
+}
+
+Unit::Unit(const CCUnitID & id, uint32_t slot)
+    : m_unitID(id)
+    , m_slot(slot)
+{
+
+}
+
+// the cached slot is only trusted while the snapshot still holds this unit there, otherwise it is looked up again
+uint32_t Unit::getSlot() const
 {
+    if (m_slot >= s_snapshot->size() || s_snapshot->getID(m_slot) != m_unitID)
+    {
+        m_slot = s_snapshot->getSlot(m_unitID);
+    }
 
+    return m_slot;
 }
 
+// the bot is no longer needed now that units are read from the bound snapshot, the parameter is kept for the callers
 #ifdef SC2API
-Unit::Unit(const sc2::Unit * unit, CCBot & bot)
-    : m_bot(&bot)
-    , m_unit(unit)
-    , m_unitID(unit->tag)
-    , m_unitType(unit->unit_type, bot)
+Unit::Unit(const sc2::Unit * unit, CCBot & /* bot */)
+    : m_unitID(unit ? unit->tag : InvalidID)
+    , m_slot(UnitSnapshot::InvalidSlot)
 {
     
 }
 
+// units that are not in this step's snapshot, like dead units or enemies out of vision, come from the API's unit pool
 const sc2::Unit * Unit::getUnitPtr() const
 {
-    return m_unit;
+    if (!isValid()) { return nullptr; }
+
+    const uint32_t slot = getSlot();
+    return slot != UnitSnapshot::InvalidSlot ? s_snapshot->getUnitPtr(slot) : s_bot->Observation()->GetUnit(m_unitID);
 }
 
 const sc2::UnitTypeID & Unit::getAPIUnitType() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
-    return m_unit->unit_type;
-}
-
-void Unit::pushRepairUnit(Unit unit) 
-{
-
-	m_repairUnits.push_back(unit);
-	repairCheckSize++;
+    return getUnitPtr()->unit_type;
 }
 
 #else
-Unit::Unit(const BWAPI::Unit unit, CCBot & bot)
-    : m_bot(&bot)
-    , m_unit(unit)
-    , m_unitID(unit->getID())
-    , m_unitType(unit->getType(), bot)
+Unit::Unit(const BWAPI::Unit unit, CCBot & /* bot */)
+    : m_unitID(unit ? unit->getID() : InvalidID)
+    , m_slot(UnitSnapshot::InvalidSlot)
 {
     
 }
 
 const BWAPI::Unit Unit::getUnitPtr() const
 {
-    return m_unit;
+    if (!isValid()) { return nullptr; }
+
+    const uint32_t slot = getSlot();
+    return slot != UnitSnapshot::InvalidSlot ? s_snapshot->getUnitPtr(slot) : BWAPI::Broodwar->getUnit(m_unitID);
 }
 
 const BWAPI::UnitType & Unit::getAPIUnitType() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
-    return m_unit->getType();
+    return getUnitPtr()->getType();
 }
 
 #endif
 bool Unit::operator < (const Unit & rhs) const
 {
-    return m_unit < rhs.m_unit;
+    return m_unitID < rhs.m_unitID;
 }
 
 bool Unit::operator == (const Unit & rhs) const
 {
-    return m_unit == rhs.m_unit;
+    return m_unitID == rhs.m_unitID;
 }
 
-const UnitType & Unit::getType() const
+UnitType Unit::getType() const
 {
-    return m_unitType;
+    if (!isValid()) { return UnitType(); }
+
+    const uint32_t slot = getSlot();
+    return UnitType(slot != UnitSnapshot::InvalidSlot ? s_snapshot->getAPIUnitType(slot) : getAPIUnitType(), *s_bot);
 }
 
 
 CCPosition Unit::getPosition() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
+    const uint32_t slot = getSlot();
+    if (slot != UnitSnapshot::InvalidSlot) { return s_snapshot->getPosition(slot); }
+
 #ifdef SC2API
-    return m_unit->pos;
+    return getUnitPtr()->pos;
 #else
-    return m_unit->getPosition();
+    return getUnitPtr()->getPosition();
 #endif
 }
 
@@ -89,39 +129,48 @@ CCTilePosition Unit::getTilePosition() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
-    return Util::GetTilePosition(m_unit->pos);
+    return Util::GetTilePosition(getPosition());
 #else
-    return m_unit->getTilePosition();
+    return getUnitPtr()->getTilePosition();
 #endif
 }
 
 CCHealth Unit::getHitPoints() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
+    const uint32_t slot = getSlot();
+    if (slot != UnitSnapshot::InvalidSlot) { return s_snapshot->getHitPoints(slot); }
+
 #ifdef SC2API
-    return m_unit->health;
+    return getUnitPtr()->health;
 #else
-    return m_unit->getHitPoints();
+    return getUnitPtr()->getHitPoints();
 #endif
 }
 
 CCHealth Unit::getShields() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
+    const uint32_t slot = getSlot();
+    if (slot != UnitSnapshot::InvalidSlot) { return s_snapshot->getShields(slot); }
+
 #ifdef SC2API
-    return m_unit->shield;
+    return getUnitPtr()->shield;
 #else
-    return m_unit->getShields();
+    return getUnitPtr()->getShields();
 #endif
 }
 
 CCHealth Unit::getEnergy() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
+    const uint32_t slot = getSlot();
+    if (slot != UnitSnapshot::InvalidSlot) { return s_snapshot->getEnergy(slot); }
+
 #ifdef SC2API
-    return m_unit->energy;
+    return getUnitPtr()->energy;
 #else
-    return m_unit->getEnergy();
+    return getUnitPtr()->getEnergy();
 #endif
 }
 
@@ -129,23 +178,26 @@ float Unit::getBuildPercentage() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
-    return m_unit->build_progress;
+    return getUnitPtr()->build_progress;
 #else
-    if (getType().isBuilding()) { return m_unit->getRemainingBuildTime() / (float)getType().getAPIUnitType().buildTime(); }
-    else { return m_unit->getRemainingTrainTime() / (float)getType().getAPIUnitType().buildTime(); }
+    if (getType().isBuilding()) { return getUnitPtr()->getRemainingBuildTime() / (float)getType().getAPIUnitType().buildTime(); }
+    else { return getUnitPtr()->getRemainingTrainTime() / (float)getType().getAPIUnitType().buildTime(); }
 #endif
 }
 
 CCPlayer Unit::getPlayer() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
+    const uint32_t slot = getSlot();
+    if (slot != UnitSnapshot::InvalidSlot) { return s_snapshot->getPlayer(slot); }
+
 #ifdef SC2API
-    if (m_unit->alliance == sc2::Unit::Alliance::Self) { return 0; }
-    else if (m_unit->alliance == sc2::Unit::Alliance::Enemy) { return 1; }
+    if (getUnitPtr()->alliance == sc2::Unit::Alliance::Self) { return 0; }
+    else if (getUnitPtr()->alliance == sc2::Unit::Alliance::Enemy) { return 1; }
     else { return 2; }
 #else
-    if (m_unit->getPlayer() == BWAPI::Broodwar->self()) { return 0; }
-    else if (m_unit->getPlayer() == BWAPI::Broodwar->enemy()) { return 1; }
+    if (getUnitPtr()->getPlayer() == BWAPI::Broodwar->self()) { return 0; }
+    else if (getUnitPtr()->getPlayer() == BWAPI::Broodwar->enemy()) { return 1; }
     else { return 2; }
 #endif
 }
@@ -153,23 +205,19 @@ CCPlayer Unit::getPlayer() const
 CCUnitID Unit::getID() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
-#ifdef SC2API
-    CCUnitID id = m_unit->tag;
-#else
-    CCUnitID id = m_unit->getID();
-#endif
-
-    BOT_ASSERT(id == m_unitID, "Unit ID changed somehow");
-    return id;
+    return m_unitID;
 }
 
 bool Unit::isCompleted() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
+    const uint32_t slot = getSlot();
+    if (slot != UnitSnapshot::InvalidSlot) { return s_snapshot->hasFlag(slot, UnitFlags::Completed); }
+
 #ifdef SC2API
-    return m_unit->build_progress >= 1.0f;
+    return getUnitPtr()->build_progress >= 1.0f;
 #else
-    return m_unit->isCompleted();
+    return getUnitPtr()->isCompleted();
 #endif
 }
 
@@ -177,10 +225,10 @@ bool Unit::isTraining() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
-    return m_unit->orders.size() > 0;
+    return getUnitPtr()->orders.size() > 0;
 	
 #else
-    return m_unit->isTraining();
+    return getUnitPtr()->isTraining();
 #endif
 }
 
@@ -189,7 +237,7 @@ size_t Unit::getNumberOfOrders() const
 	BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
 
-	return m_unit->orders.size();
+	return getUnitPtr()->orders.size();
 #endif
 }
 
@@ -197,9 +245,9 @@ bool Unit::isBeingConstructed() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
-    return !isCompleted() && m_unit->build_progress > 0.0f;
+    return !isCompleted() && getUnitPtr()->build_progress > 0.0f;
 #else
-    return m_unit->isBeingConstructed();
+    return getUnitPtr()->isBeingConstructed();
 #endif
 }
 
@@ -207,9 +255,9 @@ int Unit::getWeaponCooldown() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
-    return (int)m_unit->weapon_cooldown;
+    return (int)getUnitPtr()->weapon_cooldown;
 #else
-    return std::max(m_unit->getGroundWeaponCooldown(), m_unit->getAirWeaponCooldown());
+    return std::max(getUnitPtr()->getGroundWeaponCooldown(), getUnitPtr()->getAirWeaponCooldown());
 #endif
 }
 
@@ -217,74 +265,92 @@ bool Unit::isCloaked() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
-    return m_unit->cloak;
+    return getUnitPtr()->cloak;
 #else
-    return m_unit->isCloaked();
+    return getUnitPtr()->isCloaked();
 #endif
 }
 
 bool Unit::isFlying() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
+    const uint32_t slot = getSlot();
+    if (slot != UnitSnapshot::InvalidSlot) { return s_snapshot->hasFlag(slot, UnitFlags::Flying); }
+
 #ifdef SC2API
-    return m_unit->is_flying;
+    return getUnitPtr()->is_flying;
 #else
-    return m_unit->isFlying();
+    return getUnitPtr()->isFlying();
 #endif
 }
 
 bool Unit::isAlive() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
+    const uint32_t slot = getSlot();
+    if (slot != UnitSnapshot::InvalidSlot) { return s_snapshot->hasFlag(slot, UnitFlags::Alive); }
+
+    // dead units drop out of the snapshot, and the API may have dropped them as well
+    if (!getUnitPtr()) { return false; }
+
 #ifdef SC2API
-    return m_unit->is_alive;
+    return getUnitPtr()->is_alive;
 #else
-    return m_unit->getHitPoints() > 0;
+    return getUnitPtr()->getHitPoints() > 0;
 #endif
 }
 
 bool Unit::isPowered() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
+    const uint32_t slot = getSlot();
+    if (slot != UnitSnapshot::InvalidSlot) { return s_snapshot->hasFlag(slot, UnitFlags::Powered); }
+
 #ifdef SC2API
-    return m_unit->is_powered;
+    return getUnitPtr()->is_powered;
 #else
-    return m_unit->isPowered();
+    return getUnitPtr()->isPowered();
 #endif
 }
 
 bool Unit::isIdle() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
+    const uint32_t slot = getSlot();
+    if (slot != UnitSnapshot::InvalidSlot) { return s_snapshot->hasFlag(slot, UnitFlags::Idle); }
+
 #ifdef SC2API
-    return m_unit->orders.empty();
+    return getUnitPtr()->orders.empty();
 #else
-    return m_unit->isIdle() && !m_unit->isMoving() && !m_unit->isGatheringGas() && !m_unit->isGatheringMinerals();
+    return getUnitPtr()->isIdle() && !getUnitPtr()->isMoving() && !getUnitPtr()->isGatheringGas() && !getUnitPtr()->isGatheringMinerals();
 #endif
 }
 
 bool Unit::isBurrowed() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
+    const uint32_t slot = getSlot();
+    if (slot != UnitSnapshot::InvalidSlot) { return s_snapshot->hasFlag(slot, UnitFlags::Burrowed); }
+
 #ifdef SC2API
-    return m_unit->is_burrowed;
+    return getUnitPtr()->is_burrowed;
 #else
-    return m_unit->isBurrowed();
+    return getUnitPtr()->isBurrowed();
 #endif
 }
 
 bool Unit::isValid() const
 {
-    return m_unit != nullptr;
+    return m_unitID != InvalidID;
 }
 
 void Unit::stop() const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
-    m_bot->Actions()->UnitCommand(m_unit, sc2::ABILITY_ID::STOP);
+    s_bot->Actions()->UnitCommand(getUnitPtr(), sc2::ABILITY_ID::STOP);
 #else
-    m_unit->stop();
+    getUnitPtr()->stop();
 #endif
 }
 
@@ -293,9 +359,9 @@ void Unit::attackUnit(const Unit & target) const
     BOT_ASSERT(isValid(), "Unit is not valid");
     BOT_ASSERT(target.isValid(), "Target is not valid");
 #ifdef SC2API
-    m_bot->Actions()->UnitCommand(m_unit, sc2::ABILITY_ID::ATTACK_ATTACK, target.getUnitPtr());
+    s_bot->Actions()->UnitCommand(getUnitPtr(), sc2::ABILITY_ID::ATTACK_ATTACK, target.getUnitPtr());
 #else
-    m_unit->attack(target.getUnitPtr());
+    getUnitPtr()->attack(target.getUnitPtr());
 #endif
 }
 
@@ -303,9 +369,9 @@ void Unit::attackMove(const CCPosition & targetPosition) const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
-    m_bot->Actions()->UnitCommand(m_unit, sc2::ABILITY_ID::ATTACK_ATTACK, targetPosition);
+    s_bot->Actions()->UnitCommand(getUnitPtr(), sc2::ABILITY_ID::ATTACK_ATTACK, targetPosition);
 #else
-    m_unit->attack(targetPosition);
+    getUnitPtr()->attack(targetPosition);
 #endif
 }
 
@@ -313,9 +379,9 @@ void Unit::move(const CCPosition & targetPosition) const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
-    m_bot->Actions()->UnitCommand(m_unit, sc2::ABILITY_ID::MOVE, targetPosition);
+    s_bot->Actions()->UnitCommand(getUnitPtr(), sc2::ABILITY_ID::MOVE, targetPosition);
 #else
-    m_unit->move(targetPosition);
+    getUnitPtr()->move(targetPosition);
 #endif
 }
 
@@ -323,9 +389,9 @@ void Unit::move(const CCTilePosition & targetPosition) const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
-    m_bot->Actions()->UnitCommand(m_unit, sc2::ABILITY_ID::MOVE, CCPosition((float)targetPosition.x, (float)targetPosition.y));
+    s_bot->Actions()->UnitCommand(getUnitPtr(), sc2::ABILITY_ID::MOVE, CCPosition((float)targetPosition.x, (float)targetPosition.y));
 #else
-    m_unit->move(CCPosition(targetPosition));
+    getUnitPtr()->move(CCPosition(targetPosition));
 #endif
 }
 
@@ -333,28 +399,28 @@ void Unit::rightClick(const Unit & target) const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
-    m_bot->Actions()->UnitCommand(m_unit, sc2::ABILITY_ID::SMART, target.getUnitPtr());
+    s_bot->Actions()->UnitCommand(getUnitPtr(), sc2::ABILITY_ID::SMART, target.getUnitPtr());
 #else
-    m_unit->rightClick(target.getUnitPtr());
+    getUnitPtr()->rightClick(target.getUnitPtr());
 #endif
 }
 
 void Unit::repair(const Unit & target) const
 {
-	m_bot->Actions()->UnitCommand(m_unit, sc2::ABILITY_ID::EFFECT_REPAIR, target.getUnitPtr());
+	s_bot->Actions()->UnitCommand(getUnitPtr(), sc2::ABILITY_ID::EFFECT_REPAIR, target.getUnitPtr());
 }
 
 void Unit::build(const UnitType & buildingType, CCTilePosition pos) const
 {
-	if (m_bot->Map().isConnected(getTilePosition(), pos)) {
-		m_bot->Actions()->UnitCommand(m_unit, m_bot->Data(buildingType).buildAbility, Util::GetPosition(pos));
+	if (s_bot->Map().isConnected(getTilePosition(), pos)) {
+		s_bot->Actions()->UnitCommand(getUnitPtr(), s_bot->Data(buildingType).buildAbility, Util::GetPosition(pos));
 	}
-    //BOT_ASSERT(m_bot->Map().isConnected(getTilePosition(), pos), "Error: Build Position is not connected to worker");
+    //BOT_ASSERT(s_bot->Map().isConnected(getTilePosition(), pos), "Error: Build Position is not connected to worker");
     BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
     
 #else
-    m_unit->build(buildingType.getAPIUnitType(), pos);
+    getUnitPtr()->build(buildingType.getAPIUnitType(), pos);
 #endif
 }
 
@@ -362,21 +428,21 @@ void Unit::useMULE(const Unit & target) const
 {
 	BOT_ASSERT(isValid(), "Unit is not valid");
 	BOT_ASSERT(target.isValid(), "Unit is not valid");
-	//std::cout << "Casting MULE! " << m_unit->unit_type.to_string() << ", x: " << target.getPosition().x  << ", y: " << target.getPosition().y << "\n";
+	//std::cout << "Casting MULE! " << getUnitPtr()->unit_type.to_string() << ", x: " << target.getPosition().x  << ", y: " << target.getPosition().y << "\n";
 
-	m_bot->Actions()->UnitCommand(m_unit, sc2::ABILITY_ID::EFFECT_CALLDOWNMULE, target.getUnitPtr());
+	s_bot->Actions()->UnitCommand(getUnitPtr(), sc2::ABILITY_ID::EFFECT_CALLDOWNMULE, target.getUnitPtr());
 }
 
 void Unit::lowerDepot() const
 {
-	m_bot->Actions()->UnitCommand(m_unit, sc2::ABILITY_ID::MORPH_SUPPLYDEPOT_LOWER);
+	s_bot->Actions()->UnitCommand(getUnitPtr(), sc2::ABILITY_ID::MORPH_SUPPLYDEPOT_LOWER);
 }
 
 void Unit::buildTarget(const UnitType & buildingType, const Unit & target) const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
-    m_bot->Actions()->UnitCommand(m_unit, m_bot->Data(buildingType).buildAbility, target.getUnitPtr());
+    s_bot->Actions()->UnitCommand(getUnitPtr(), s_bot->Data(buildingType).buildAbility, target.getUnitPtr());
 #else
     BOT_ASSERT(false, "buildTarget shouldn't be called for BWAPI bots");
 #endif
@@ -386,10 +452,10 @@ void Unit::train(const UnitType & type) const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
-    m_bot->Actions()->UnitCommand(m_unit, m_bot->Data(type).buildAbility);
+    s_bot->Actions()->UnitCommand(getUnitPtr(), s_bot->Data(type).buildAbility);
 
 #else
-    m_unit->train(type.getAPIUnitType());
+    getUnitPtr()->train(type.getAPIUnitType());
 #endif
 }
 
@@ -397,7 +463,7 @@ void Unit::upgrade(const MetaType & type) const
 {
 	BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
-	m_bot->Actions()->UnitCommand(m_unit, m_bot->Data(type).buildAbility);
+	s_bot->Actions()->UnitCommand(getUnitPtr(), s_bot->Data(type).buildAbility);
 #endif
 }
 
@@ -405,47 +471,47 @@ void Unit::morph(const UnitType & type) const
 {
     BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
-    m_bot->Actions()->UnitCommand(m_unit, m_bot->Data(type).buildAbility);
+    s_bot->Actions()->UnitCommand(getUnitPtr(), s_bot->Data(type).buildAbility);
 #else
-    m_unit->morph(type.getAPIUnitType());
+    getUnitPtr()->morph(type.getAPIUnitType());
 #endif
 }
 
 void Unit::lift() const
 {
 	BOT_ASSERT(isValid(), "Unit is not valid");
-	m_bot->Actions()->UnitCommand(m_unit, sc2::ABILITY_ID::LIFT);
+	s_bot->Actions()->UnitCommand(getUnitPtr(), sc2::ABILITY_ID::LIFT);
 }
 
 void Unit::land(CCTilePosition pos) const
 {
 	BOT_ASSERT(isValid(), "Unit is not valid");
-	m_bot->Actions()->UnitCommand(m_unit, sc2::ABILITY_ID::LAND, Util::GetPosition(pos), true);
+	s_bot->Actions()->UnitCommand(getUnitPtr(), sc2::ABILITY_ID::LAND, Util::GetPosition(pos), true);
 
 }
 
 void Unit::cancel() const
 {
 	BOT_ASSERT(isValid(), "Unit is not valid");
-	m_bot->Actions()->UnitCommand(m_unit, sc2::ABILITY_ID::CANCEL);
+	s_bot->Actions()->UnitCommand(getUnitPtr(), sc2::ABILITY_ID::CANCEL);
 }
 
 void Unit::queuedMove(const CCPosition & targetPosition) const
 {
 	BOT_ASSERT(isValid(), "Unit is not valid");
 #ifdef SC2API
-	m_bot->Actions()->UnitCommand(m_unit, sc2::ABILITY_ID::MOVE, targetPosition,true);
+	s_bot->Actions()->UnitCommand(getUnitPtr(), sc2::ABILITY_ID::MOVE, targetPosition,true);
 #else
-	m_unit->move(targetPosition);
+	getUnitPtr()->move(targetPosition);
 #endif
 }
 
 bool Unit::isConstructing(const UnitType & type) const
 {
 #ifdef SC2API
-    sc2::AbilityID buildAbility = m_bot->Data(type).buildAbility;
+    sc2::AbilityID buildAbility = s_bot->Data(type).buildAbility;
     return (getUnitPtr()->orders.size() > 0) && (getUnitPtr()->orders[0].ability_id == buildAbility);
 #else
-    return m_unit->isConstructing();
+    return getUnitPtr()->isConstructing();
 #endif
 }
\ No newline at end of file
@@ -5,35 +5,35 @@
 #include "MetaType.h"
 
 class CCBot;
+class UnitSnapshot;
 
+// A unit is a small handle: the unit's id plus the slot it had in CCBot's unit snapshot the last time it was looked at
+// it is trivially copyable and 16 bytes, so the managers can copy units around freely without allocating
+// while the unit is visible its state comes from the snapshot, once it is not the handle falls back to the API's unit
 class Unit
 {
-    mutable CCBot * m_bot;
-    CCUnitID    m_unitID;
-    UnitType    m_unitType;
+    static CCBot *              s_bot;
+    static const UnitSnapshot * s_snapshot;
 
-#ifdef SC2API
-    const sc2::Unit * m_unit;
-#else
-    BWAPI::Unit m_unit;
-#endif
+    CCUnitID            m_unitID;
+    mutable uint32_t    m_slot;
+
+    uint32_t getSlot() const;
 
 public:
 
+    static const CCUnitID InvalidID;
+
+    // every handle reads through the bot's snapshot, CCBot binds it once on construction
+    static void Bind(CCBot & bot, const UnitSnapshot & snapshot);
+
     Unit();
-	
+    Unit(const CCUnitID & id, uint32_t slot);
 
 #ifdef SC2API
     Unit(const sc2::Unit * unit, CCBot & bot);
     const sc2::Unit * getUnitPtr() const;
     const sc2::UnitTypeID & getAPIUnitType() const;
-
-	
-
-	std::vector<Unit>	m_repairUnits;
-	void pushRepairUnit(Unit  unit);
-	int repairCheckSize = 0;
-
 #else
     Unit(const BWAPI::Unit unit, CCBot & bot);
     const BWAPI::Unit getUnitPtr() const;
@@ -43,7 +43,7 @@ public:
     bool operator < (const Unit & rhs) const;
     bool operator == (const Unit & rhs) const;
 
-    const UnitType & getType() const;
+    UnitType getType() const;
 
     CCPosition getPosition() const;
     CCTilePosition getTilePosition() const;
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Common.h"
+
+#ifdef SC2API
+
+// Compile time classification of unit types
+// the managers check these class bits instead of comparing getName() against string literals,
+// which built a new std::string through sc2::UnitTypeToName on every call
+namespace UnitClass
+{
+    enum : uint32_t
+    {
+        None            = 0,
+        ZerglingThreat  = 1 << 0,   // cheap melee swarm, answered by walling the ramp with bunkers
+        RoachThreat     = 1 << 1,   // armoured ground push
+        AirThreat       = 1 << 2,   // mutalisks and the tech that unlocks them, answered with turrets
+        RepairPriority  = 1 << 4,   // gets extra repair workers when damaged, see GetRepairGroup
+        StaticDefense   = 1 << 5,   // bunkers and missile turrets
+        AddonProducer   = 1 << 6,   // production building that needs the 2x2 to its right free for an addon
+        SupplyDepot     = 1 << 7,   // raised or lowered
+        TightPlacement  = 1 << 8,   // placed without the configured building spacing
+    };
+
+    constexpr uint32_t GetClasses(sc2::UNIT_TYPEID type)
+    {
+        switch (type)
+        {
+            case sc2::UNIT_TYPEID::ZERG_ZERGLING:               return ZerglingThreat;
+            case sc2::UNIT_TYPEID::ZERG_ROACH:                  return RoachThreat;
+            case sc2::UNIT_TYPEID::ZERG_MUTALISK:               return AirThreat;
+            case sc2::UNIT_TYPEID::ZERG_SPIRE:                  return AirThreat;
+
+            case sc2::UNIT_TYPEID::TERRAN_BUNKER:               return StaticDefense | RepairPriority | TightPlacement;
+            case sc2::UNIT_TYPEID::TERRAN_MISSILETURRET:        return StaticDefense | RepairPriority | TightPlacement;
+            case sc2::UNIT_TYPEID::TERRAN_PLANETARYFORTRESS:    return RepairPriority;
+            case sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMAND:       return RepairPriority;
+            case sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOT:          return SupplyDepot | RepairPriority;
+            case sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOTLOWERED:   return SupplyDepot;
+            case sc2::UNIT_TYPEID::TERRAN_BARRACKS:             return AddonProducer;
+            case sc2::UNIT_TYPEID::TERRAN_FACTORY:              return AddonProducer;
+            case sc2::UNIT_TYPEID::TERRAN_STARPORT:             return AddonProducer | TightPlacement;
+            case sc2::UNIT_TYPEID::TERRAN_ENGINEERINGBAY:       return TightPlacement;
+            case sc2::UNIT_TYPEID::TERRAN_ARMORY:               return TightPlacement;
+
+            default:                                            return None;
+        }
+    }
+
+    constexpr bool Is(sc2::UNIT_TYPEID type, uint32_t classes)
+    {
+        return (GetClasses(type) & classes) != 0;
+    }
+
+    // RepairPriority buildings are split into groups that each get their own worker count per threat level
+    namespace RepairGroup
+    {
+        enum { Bunker = 0, Turret = 1, TownHall = 2, Depot = 3, Size = 4, None = 4 };
+    }
+
+    constexpr int GetRepairGroup(sc2::UNIT_TYPEID type)
+    {
+        switch (type)
+        {
+            case sc2::UNIT_TYPEID::TERRAN_BUNKER:               return RepairGroup::Bunker;
+            case sc2::UNIT_TYPEID::TERRAN_MISSILETURRET:        return RepairGroup::Turret;
+            case sc2::UNIT_TYPEID::TERRAN_PLANETARYFORTRESS:    return RepairGroup::TownHall;
+            case sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMAND:       return RepairGroup::TownHall;
+            case sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOT:          return RepairGroup::Depot;
+            default:                                            return RepairGroup::None;
+        }
+    }
+
+    // repair workers for a RepairPriority building, indexed by [threat level][repair group]
+    const int MaxRepairThreatLevel = 3;
+    constexpr int RepairWorkers[MaxRepairThreatLevel + 1][RepairGroup::Size] =
+    {
+        //  Bunker  Turret  TownHall  Depot
+        {   2,      2,      2,        1 },
+        {   3,      2,      3,        1 },
+        {   4,      3,      4,        2 },
+        {   5,      4,      5,        3 },
+    };
+}
+
+#endif
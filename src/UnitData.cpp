@@ -10,12 +10,20 @@ UnitData::UnitData()
 
 void UnitData::updateUnit(const Unit & unit)
 {
+    const UnitType type = unit.getType();
+    const bool completed = unit.isCompleted();
+
+    // a unit that morphed or finished since last frame moves to its new count
     bool firstSeen = false;
-    const auto & it = m_unitMap.find(unit);
+    auto it = m_unitMap.find(unit);
     if (it == m_unitMap.end())
     {
         firstSeen = true;
-        m_unitMap[unit] = UnitInfo();
+    }
+    else if (!(it->second.type == type) || it->second.completed != completed)
+    {
+        removeFromType(it->second);
+        firstSeen = true;
     }
 
     UnitInfo & ui   = m_unitMap[unit];
@@ -24,29 +32,32 @@ void UnitData::updateUnit(const Unit & unit)
     ui.lastPosition = unit.getPosition();
     ui.lastHealth   = unit.getHitPoints();
     ui.lastShields  = unit.getShields();
-    ui.type         = unit.getType();
+    ui.type         = type;
+    ui.completed    = completed;
     ui.progress     = unit.getBuildPercentage();
     ui.id           = unit.getID();
 
     if (firstSeen)
     {
-        if (m_numUnits.find(ui.type) == m_numUnits.end())
-        {
-            m_numUnits[ui.type] = 0;
-        }
-
-        m_numUnits[ui.type]++;
+        addToType(ui);
     }
 }
 
 void UnitData::killUnit(const Unit & unit)
 {
+    // the unit is already gone from the game, so everything about it comes from what we last saw
+    auto it = m_unitMap.find(unit);
+    if (it == m_unitMap.end())
+    {
+        return;
+    }
+
     //_mineralsLost += unit->getType().mineralPrice();
     //_gasLost += unit->getType().gasPrice();
-    m_numUnits[unit.getType()]--;
-    m_numDeadUnits[unit.getType()]++;
+    removeFromType(it->second);
+    m_typeCounts[it->second.type.getIndex()].dead++;
 
-    m_unitMap.erase(unit);
+    m_unitMap.erase(it);
 }
 
 void UnitData::removeBadUnits()
@@ -55,7 +66,7 @@ void UnitData::removeBadUnits()
     {
         if (badUnitInfo(iter->second))
         {
-            m_numUnits[iter->second.type]--;
+            removeFromType(iter->second);
             iter = m_unitMap.erase(iter);
         }
         else
@@ -65,6 +76,52 @@ void UnitData::removeBadUnits()
     }
 }
 
+void UnitData::addToType(UnitInfo & ui)
+{
+    const size_t index = ui.type.getIndex();
+    if (index >= m_typeCounts.size())
+    {
+        m_typeCounts.resize(index + 1);
+    }
+
+    UnitTypeCounts & counts = m_typeCounts[index];
+    counts.live++;
+    (ui.completed ? counts.completed : counts.inProduction)++;
+
+    // push onto the front of the type's list
+    ui.prevOfType = Unit::InvalidID;
+    ui.nextOfType = counts.firstUnit;
+    if (counts.firstUnit != Unit::InvalidID)
+    {
+        m_unitMap.findID(counts.firstUnit)->second.prevOfType = ui.id;
+    }
+    counts.firstUnit = ui.id;
+}
+
+void UnitData::removeFromType(UnitInfo & ui)
+{
+    UnitTypeCounts & counts = m_typeCounts[ui.type.getIndex()];
+    counts.live--;
+    (ui.completed ? counts.completed : counts.inProduction)--;
+
+    if (ui.prevOfType != Unit::InvalidID)
+    {
+        m_unitMap.findID(ui.prevOfType)->second.nextOfType = ui.nextOfType;
+    }
+    else
+    {
+        counts.firstUnit = ui.nextOfType;
+    }
+
+    if (ui.nextOfType != Unit::InvalidID)
+    {
+        m_unitMap.findID(ui.nextOfType)->second.prevOfType = ui.prevOfType;
+    }
+
+    ui.prevOfType = Unit::InvalidID;
+    ui.nextOfType = Unit::InvalidID;
+}
+
 bool UnitData::badUnitInfo(const UnitInfo & ui) const
 {
     return false;
@@ -80,27 +137,45 @@ int UnitData::getMineralsLost() const
     return m_mineralsLost;
 }
 
+const UnitTypeCounts & UnitData::getTypeCounts(const UnitType & t) const
+{
+    static const UnitTypeCounts none;
+
+    const size_t index = t.getIndex();
+    return index < m_typeCounts.size() ? m_typeCounts[index] : none;
+}
+
 int UnitData::getNumUnits(const UnitType & t) const
 {
-    if (m_numUnits.find(t) == m_numUnits.end())
-    {
-        return 0;
-    }
+    return getTypeCounts(t).live;
+}
 
-    return m_numUnits.at(t);
+int UnitData::getNumCompletedUnits(const UnitType & t) const
+{
+    return getTypeCounts(t).completed;
+}
+
+int UnitData::getNumUnitsInProduction(const UnitType & t) const
+{
+    return getTypeCounts(t).inProduction;
 }
 
 int UnitData::getNumDeadUnits(const UnitType & t) const
 {
-    if (m_numDeadUnits.find(t) == m_numDeadUnits.end())
+    return getTypeCounts(t).dead;
+}
+
+void UnitData::getUnitsOfType(const UnitType & t, std::vector<Unit> & units) const
+{
+    for (CCUnitID id = getTypeCounts(t).firstUnit; id != Unit::InvalidID;)
     {
-        return 0;
+        const UnitInfo & ui = m_unitMap.findID(id)->second;
+        units.push_back(ui.unit);
+        id = ui.nextOfType;
     }
-
-    return m_numDeadUnits.at(t);
 }
 
-const std::map<Unit, UnitInfo> & UnitData::getUnitInfoMap() const
+const FlatUnitMap<Unit, UnitInfo> & UnitData::getUnitInfoMap() const
 {
     return m_unitMap;
 }
\ No newline at end of file
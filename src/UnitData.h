@@ -3,6 +3,7 @@
 #include "Common.h"
 #include "Util.h"
 #include "Unit.h"
+#include "FlatUnitMap.h"
 #include "UnitType.h"
 
 struct UnitInfo
@@ -18,6 +19,11 @@ struct UnitInfo
     CCPosition      lastPosition;
     UnitType        type;
     float           progress;
+    bool            completed;
+
+    // links in UnitData's list of live units of the same type
+    CCUnitID        prevOfType;
+    CCUnitID        nextOfType;
 
     UnitInfo()
         : id(0)
@@ -25,6 +31,9 @@ struct UnitInfo
         , player(-1)
         , lastPosition(0, 0)
         , progress(1.0)
+        , completed(false)
+        , prevOfType(Unit::InvalidID)
+        , nextOfType(Unit::InvalidID)
     {
 
     }
@@ -47,16 +56,41 @@ struct UnitInfo
 
 typedef std::vector<UnitInfo> UnitInfoVector;
 
+struct UnitTypeCounts
+{
+    int         live;           // every unit of the type we know is alive
+    int         completed;
+    int         inProduction;   // alive but not completed yet, like buildings under construction
+    int         dead;
+    CCUnitID    firstUnit;      // head of the list of live units of the type, linked through UnitInfo
+
+    UnitTypeCounts()
+        : live(0)
+        , completed(0)
+        , inProduction(0)
+        , dead(0)
+        , firstUnit(Unit::InvalidID)
+    {
+
+    }
+};
+
+// Everything we know about one player's units
+// the per type counts are kept up to date as units are first seen, change type or completion, and die,
+// so asking how many units of a type a player has is an array lookup instead of a scan over their units
 class UnitData
 {
-    std::map<Unit, UnitInfo>    m_unitMap;
-    std::map<UnitType, int>     m_numDeadUnits;
-    std::map<UnitType, int>     m_numUnits;
+    FlatUnitMap<Unit, UnitInfo> m_unitMap;
+    std::vector<UnitTypeCounts> m_typeCounts;   // indexed by UnitType::getIndex
     int                         m_mineralsLost;
     int	                        m_gasLost;
 
     bool badUnitInfo(const UnitInfo & ui) const;
 
+    const UnitTypeCounts & getTypeCounts(const UnitType & t) const;
+    void    addToType(UnitInfo & ui);
+    void    removeFromType(UnitInfo & ui);
+
 public:
 
     UnitData();
@@ -68,6 +102,9 @@ public:
     int		getGasLost()                                const;
     int		getMineralsLost()                           const;
     int		getNumUnits(const UnitType & t)              const;
+    int		getNumCompletedUnits(const UnitType & t)     const;
+    int		getNumUnitsInProduction(const UnitType & t)  const;
     int		getNumDeadUnits(const UnitType & t)          const;
-    const	std::map<Unit, UnitInfo> & getUnitInfoMap()  const;
+    void	getUnitsOfType(const UnitType & t, std::vector<Unit> & units) const;
+    const	FlatUnitMap<Unit, UnitInfo> & getUnitInfoMap()  const;
 };
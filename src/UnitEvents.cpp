@@ -0,0 +1,52 @@
+#include "UnitEvents.h"
+#include <algorithm>
+
+UnitEventBus::UnitEventBus()
+{
+    std::fill(m_dispatched, m_dispatched + UnitEvents::Num, 0);
+}
+
+void UnitEventBus::subscribe(int type, const Handler & handler)
+{
+    BOT_ASSERT(type >= 0 && type < UnitEvents::Num, "Unknown unit event type: %d", type);
+    m_handlers[type].push_back(handler);
+}
+
+void UnitEventBus::post(int type, const Unit & unit)
+{
+    BOT_ASSERT(type >= 0 && type < UnitEvents::Num, "Unknown unit event type: %d", type);
+
+    if (!unit.isValid())
+    {
+        return;
+    }
+
+    Event e;
+    e.type = type;
+    e.unit = unit;
+    m_queue.push_back(e);
+}
+
+void UnitEventBus::dispatch()
+{
+    std::fill(m_dispatched, m_dispatched + UnitEvents::Num, 0);
+
+    // indexed, since a handler may post more events and grow the queue
+    for (size_t i(0); i < m_queue.size(); ++i)
+    {
+        const Event e = m_queue[i];
+        for (auto & handler : m_handlers[e.type])
+        {
+            handler(e.unit);
+        }
+
+        m_dispatched[e.type]++;
+    }
+
+    m_queue.clear();
+}
+
+int UnitEventBus::dispatched(int type) const
+{
+    return m_dispatched[type];
+}
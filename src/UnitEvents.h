@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Common.h"
+#include "Unit.h"
+#include <functional>
+
+namespace UnitEvents
+{
+    enum { Created, Destroyed, ConstructionComplete, Idle, EnterVision, Num };
+}
+
+// Unit lifecycle events from the game, handed to the managers that subscribe to them
+// the API reports events while it processes the observation, before any manager has run this step,
+// so CCBot queues them and dispatches the whole queue once the unit snapshot for the step is built
+// handlers run in the order they subscribed, and events posted by a handler are delivered in the same dispatch
+class UnitEventBus
+{
+public:
+
+    typedef std::function<void(const Unit &)> Handler;
+
+private:
+
+    struct Event
+    {
+        int     type;
+        Unit    unit;
+    };
+
+    std::vector<Handler>    m_handlers[UnitEvents::Num];
+    std::vector<Event>      m_queue;
+    int                     m_dispatched[UnitEvents::Num];
+
+public:
+
+    UnitEventBus();
+
+    void    subscribe(int type, const Handler & handler);
+    void    post(int type, const Unit & unit);
+    void    dispatch();
+
+    // events of this type delivered by the last dispatch
+    int     dispatched(int type) const;
+};
@@ -13,7 +13,14 @@ UnitInfoManager::UnitInfoManager(CCBot & bot)
 
 void UnitInfoManager::onStart()
 {
-
+    // a dead unit may not say who owned it anymore, so every player's data is asked to forget it
+    m_bot.Events().subscribe(UnitEvents::Destroyed, [this](const Unit & unit)
+    {
+        for (auto & kv : m_unitData)
+        {
+            kv.second.killUnit(unit);
+        }
+    });
 }
 
 void UnitInfoManager::onFrame()
@@ -41,7 +48,7 @@ void UnitInfoManager::updateUnitInfo()
     m_unitData[Players::Neutral].removeBadUnits();
 }
 
-const std::map<Unit, UnitInfo> & UnitInfoManager::getUnitInfoMap(CCPlayer player) const
+const FlatUnitMap<Unit, UnitInfo> & UnitInfoManager::getUnitInfoMap(CCPlayer player) const
 {
     return getUnitData(player).getUnitInfoMap();
 }
@@ -179,13 +186,21 @@ void UnitInfoManager::drawSelectedUnitDebugInfo()
 }
 
 // passing in a unit type of 0 returns a count of all units
+// counts for a single type come from the per type counters, which include units we know of but can't see right now,
+// like enemy units that left vision or our workers inside a refinery
 size_t UnitInfoManager::getUnitTypeCount(CCPlayer player, UnitType type, bool completed) const
 {
+    if (type.isValid())
+    {
+        const UnitData & data = getUnitData(player);
+        return (size_t)(completed ? data.getNumCompletedUnits(type) : data.getNumUnits(type));
+    }
+
     size_t count = 0;
 
     for (auto & unit : getUnits(player))
     {
-        if ((!type.isValid() || type == unit.getType()) && (!completed || unit.isCompleted()))
+        if (!completed || unit.isCompleted())
         {
             count++;
         }
@@ -194,6 +209,29 @@ size_t UnitInfoManager::getUnitTypeCount(CCPlayer player, UnitType type, bool co
     return count;
 }
 
+size_t UnitInfoManager::getUnitTypeInProductionCount(CCPlayer player, const UnitType & type) const
+{
+    return (size_t)getUnitData(player).getNumUnitsInProduction(type);
+}
+
+size_t UnitInfoManager::getUnitTypeDeadCount(CCPlayer player, const UnitType & type) const
+{
+    return (size_t)getUnitData(player).getNumDeadUnits(type);
+}
+
+// like getUnits, this only returns units that are visible this frame
+void UnitInfoManager::getUnitsOfType(CCPlayer player, const UnitType & type, std::vector<Unit> & units) const
+{
+    const size_t first = units.size();
+    getUnitData(player).getUnitsOfType(type, units);
+
+    const UnitSnapshot & snapshot = m_bot.Snapshot();
+    units.erase(std::remove_if(units.begin() + first, units.end(), [&snapshot](const Unit & unit)
+    {
+        return snapshot.getSlot(unit.getID()) == UnitSnapshot::InvalidSlot;
+    }), units.end());
+}
+
 void UnitInfoManager::drawUnitInformation(float x,float y) const
 {
     if (!m_bot.Config().DrawEnemyUnitInfo)
@@ -272,5 +310,8 @@ void UnitInfoManager::getNearbyForce(std::vector<UnitInfo> & unitInfo, CCPositio
 
 const UnitData & UnitInfoManager::getUnitData(CCPlayer player) const
 {
-    return m_unitData.find(player)->second;
+    static const UnitData noUnits;
+
+    auto it = m_unitData.find(player);
+    return it != m_unitData.end() ? it->second : noUnits;
 }
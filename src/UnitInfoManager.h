@@ -31,10 +31,13 @@ public:
     const std::vector<Unit> & getUnits(CCPlayer player) const;
 
     size_t                  getUnitTypeCount(CCPlayer player, UnitType type, bool completed = true) const;
+    size_t                  getUnitTypeInProductionCount(CCPlayer player, const UnitType & type) const;
+    size_t                  getUnitTypeDeadCount(CCPlayer player, const UnitType & type) const;
+    void                    getUnitsOfType(CCPlayer player, const UnitType & type, std::vector<Unit> & units) const;
 
     void                    getNearbyForce(std::vector<UnitInfo> & unitInfo, CCPosition p, int player, float radius) const;
 
-    const std::map<Unit, UnitInfo> & getUnitInfoMap(CCPlayer player) const;
+    const FlatUnitMap<Unit, UnitInfo> & getUnitInfoMap(CCPlayer player) const;
 
     //bool                  enemyHasCloakedUnits() const;
     void                    drawUnitInformation(float x, float y) const;
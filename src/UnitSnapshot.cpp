@@ -0,0 +1,118 @@
+#include "UnitSnapshot.h"
+#include "CCBot.h"
+
+const uint32_t UnitSnapshot::InvalidSlot;
+
+UnitSnapshot::UnitSnapshot()
+{
+
+}
+
+void UnitSnapshot::clear()
+{
+    m_ids.clear();
+    m_units.clear();
+    m_positions.clear();
+    m_hitPoints.clear();
+    m_shields.clear();
+    m_energy.clear();
+    m_types.clear();
+    m_players.clear();
+    m_flags.clear();
+    m_slots.clear();
+}
+
+void UnitSnapshot::add(UnitPtr unit)
+{
+    uint8_t flags = 0;
+
+#ifdef SC2API
+    CCPlayer player = Players::Neutral;
+    if      (unit->alliance == sc2::Unit::Alliance::Self)  { player = Players::Self; }
+    else if (unit->alliance == sc2::Unit::Alliance::Enemy) { player = Players::Enemy; }
+
+    if (unit->is_flying)                { flags |= UnitFlags::Flying; }
+    if (unit->build_progress >= 1.0f)   { flags |= UnitFlags::Completed; }
+    if (unit->is_burrowed)              { flags |= UnitFlags::Burrowed; }
+    if (unit->is_alive)                 { flags |= UnitFlags::Alive; }
+    if (unit->is_powered)               { flags |= UnitFlags::Powered; }
+    if (unit->orders.empty())           { flags |= UnitFlags::Idle; }
+
+    const CCUnitID id = unit->tag;
+    m_positions.push_back(unit->pos);
+    m_hitPoints.push_back(unit->health);
+    m_shields.push_back(unit->shield);
+    m_energy.push_back(unit->energy);
+    m_types.push_back(unit->unit_type);
+#else
+    CCPlayer player = Players::Neutral;
+    if      (unit->getPlayer() == BWAPI::Broodwar->self())  { player = Players::Self; }
+    else if (unit->getPlayer() == BWAPI::Broodwar->enemy()) { player = Players::Enemy; }
+
+    if (unit->isFlying())               { flags |= UnitFlags::Flying; }
+    if (unit->isCompleted())            { flags |= UnitFlags::Completed; }
+    if (unit->isBurrowed())             { flags |= UnitFlags::Burrowed; }
+    if (unit->getHitPoints() > 0)       { flags |= UnitFlags::Alive; }
+    if (unit->isPowered())              { flags |= UnitFlags::Powered; }
+    if (unit->isIdle() && !unit->isMoving() && !unit->isGatheringGas() && !unit->isGatheringMinerals()) { flags |= UnitFlags::Idle; }
+
+    const CCUnitID id = unit->getID();
+    m_positions.push_back(unit->getPosition());
+    m_hitPoints.push_back(unit->getHitPoints());
+    m_shields.push_back(unit->getShields());
+    m_energy.push_back(unit->getEnergy());
+    m_types.push_back(unit->getType());
+#endif
+
+    m_slots[id] = (uint32_t)m_ids.size();
+    m_ids.push_back(id);
+    m_units.push_back(unit);
+    m_players.push_back((uint8_t)player);
+    m_flags.push_back(flags);
+}
+
+void UnitSnapshot::reserve(size_t numUnits)
+{
+    m_ids.reserve(numUnits);
+    m_units.reserve(numUnits);
+    m_positions.reserve(numUnits);
+    m_hitPoints.reserve(numUnits);
+    m_shields.reserve(numUnits);
+    m_energy.reserve(numUnits);
+    m_types.reserve(numUnits);
+    m_players.reserve(numUnits);
+    m_flags.reserve(numUnits);
+    m_slots.reserve(numUnits);
+}
+
+void UnitSnapshot::build(CCBot & bot)
+{
+    clear();
+
+#ifdef SC2API
+    const sc2::Units units = bot.Observation()->GetUnits();
+    reserve(units.size());
+    for (auto unit : units)
+    {
+        add(unit);
+    }
+#else
+    const BWAPI::Unitset & units = BWAPI::Broodwar->getAllUnits();
+    reserve(units.size());
+    for (auto & unit : units)
+    {
+        add(unit);
+    }
+#endif
+}
+
+size_t UnitSnapshot::size() const
+{
+    return m_ids.size();
+}
+
+uint32_t UnitSnapshot::getSlot(const CCUnitID & id) const
+{
+    auto it = m_slots.find(id);
+    return it == m_slots.end() ? InvalidSlot : it->second;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Common.h"
+#include "FlatUnitMap.h"
+
+class CCBot;
+
+namespace UnitFlags
+{
+    enum : uint8_t
+    {
+        Flying      = 1 << 0,
+        Completed   = 1 << 1,
+        Burrowed    = 1 << 2,
+        Alive       = 1 << 3,
+        Powered     = 1 << 4,
+        Idle        = 1 << 5,
+    };
+}
+
+// Struct of arrays copy of the per unit state the managers read most, refilled once per step in CCBot::setUnits
+// every visible unit gets one slot, and slot i of each array describes the same unit, so loops over positions,
+// owners or hit points read contiguous memory instead of following a pointer into the API's unit objects
+// the buffers are cleared but never shrunk, so after the first few frames filling the snapshot does not allocate
+class UnitSnapshot
+{
+public:
+
+#ifdef SC2API
+    typedef const sc2::Unit *   UnitPtr;
+    typedef sc2::UnitTypeID     APIUnitType;
+#else
+    typedef BWAPI::Unit         UnitPtr;
+    typedef BWAPI::UnitType     APIUnitType;
+#endif
+
+    static const uint32_t InvalidSlot = 0xFFFFFFFF;
+
+private:
+
+    std::vector<CCUnitID>       m_ids;
+    std::vector<UnitPtr>        m_units;
+    std::vector<CCPosition>     m_positions;
+    std::vector<CCHealth>       m_hitPoints;
+    std::vector<CCHealth>       m_shields;
+    std::vector<CCHealth>       m_energy;
+    std::vector<APIUnitType>    m_types;
+    std::vector<uint8_t>        m_players;
+    std::vector<uint8_t>        m_flags;
+
+    FlatUnitMap<CCUnitID, uint32_t> m_slots;   // id to slot, so looking up a unit by id is one hash probe
+
+    void    clear();
+    void    add(UnitPtr unit);
+    void    reserve(size_t numUnits);
+
+public:
+
+    UnitSnapshot();
+
+    void    build(CCBot & bot);
+
+    size_t  size() const;
+
+    // the slot of the unit with this id, or InvalidSlot if it is not visible this step
+    uint32_t getSlot(const CCUnitID & id) const;
+
+    const CCUnitID &    getID(uint32_t slot) const          { return m_ids[slot]; }
+    UnitPtr             getUnitPtr(uint32_t slot) const     { return m_units[slot]; }
+    const CCPosition &  getPosition(uint32_t slot) const    { return m_positions[slot]; }
+    CCHealth            getHitPoints(uint32_t slot) const   { return m_hitPoints[slot]; }
+    CCHealth            getShields(uint32_t slot) const     { return m_shields[slot]; }
+    CCHealth            getEnergy(uint32_t slot) const      { return m_energy[slot]; }
+    const APIUnitType & getAPIUnitType(uint32_t slot) const { return m_types[slot]; }
+    CCPlayer            getPlayer(uint32_t slot) const      { return m_players[slot]; }
+    bool                hasFlag(uint32_t slot, uint8_t flag) const { return (m_flags[slot] & flag) != 0; }
+
+    const std::vector<CCPosition> & getPositions() const    { return m_positions; }
+    const std::vector<uint8_t> &    getPlayers() const      { return m_players; }
+    const std::vector<uint8_t> &    getFlags() const        { return m_flags; }
+};
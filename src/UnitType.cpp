@@ -1,5 +1,6 @@
 #include "UnitType.h"
 #include "CCBot.h"
+#include "UnitClass.h"
 
 UnitType::UnitType()
     : m_bot(nullptr)
@@ -45,6 +46,15 @@ bool UnitType::is(const BWAPI::UnitType & type) const
 }
 
 #endif
+size_t UnitType::getIndex() const
+{
+#ifdef SC2API
+    return (size_t)(uint32_t)m_type;
+#else
+    return (size_t)m_type.getID();
+#endif
+}
+
 bool UnitType::operator < (const UnitType & rhs) const
 {
     return m_type < rhs.m_type;
@@ -295,6 +305,15 @@ bool UnitType::isReactor() const
 	return false;
 }
 
+bool UnitType::isClass(uint32_t classes) const
+{
+#ifdef SC2API
+    return UnitClass::Is(m_type.ToType(), classes);
+#else
+    return false;
+#endif
+}
+
 bool UnitType::isBuilding() const
 {
 #ifdef SC2API
@@ -343,12 +362,10 @@ int UnitType::gasPrice() const
 UnitType UnitType::GetUnitTypeFromName(const std::string & name, CCBot & bot)
 {
 #ifdef SC2API
-    for (const sc2::UnitTypeData & data : bot.Observation()->GetUnitTypeData())
+    const uint32_t typeID = bot.Names().getUnitTypeID(name);
+    if (typeID != 0)
     {
-        if (name == data.name)
-        {
-            return UnitType(data.unit_type_id, bot);
-        }
+        return UnitType(sc2::UnitTypeID(typeID), bot);
     }
 #else
 
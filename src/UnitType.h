@@ -28,6 +28,9 @@ public:
     bool is(const BWAPI::UnitType & type) const;
 #endif
 
+    // the API's numeric id for this type, for indexing dense per type arrays
+    size_t getIndex() const;
+
     bool operator < (const UnitType & rhs) const;
     bool operator == (const UnitType & rhs) const;
 
@@ -52,6 +55,9 @@ public:
 	bool isTechLab() const;
 	bool isReactor() const;
 
+    // true if this type is in any of the given UnitClass bits
+    bool isClass(uint32_t classes) const;
+
     CCPositionType getAttackRange() const;
     int tileWidth() const;
     int tileHeight() const;
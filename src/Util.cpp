@@ -54,25 +54,10 @@ CCPositionType Util::TileToPosition(float tile)
 
 const Unit Util::getClostestMineral(sc2::Point2D pos, CCBot & bot)
 {
-	Unit closestMineral;
-	double closestDistance = std::numeric_limits<double>::max();
-	
-	for (auto & mineral : bot.GetUnits())
-	{
-		if (!mineral.isValid()) { continue; }
-
-		if (mineral.getType().isMineral())
-		{
-			//std::cout << "registered depot " << unit.getID() << "\n"; //custom
-			double distance = Util::Dist(mineral.getPosition(), pos);
-			if (!closestMineral.isValid() || distance < closestDistance)
-			{
-				closestMineral = mineral;
-				closestDistance = distance;
-			}
-		}
-	}
-	return closestMineral;
+	auto isMineral = [](const Unit & unit) { return unit.getType().isMineral(); };
+
+	const std::vector<Unit> closest = bot.Spatial().nearest(pos, 1, Players::Neutral, SpatialLayers::Ground, isMineral);
+	return closest.empty() ? Unit() : closest.front();
 }
 
 UnitType Util::GetSupplyProvider(const CCRace & race, CCBot & bot)
@@ -258,28 +243,12 @@ CCPosition Util::prolongDirection(CCPosition from, CCPosition to, double percent
 #ifdef SC2API
 sc2::BuffID Util::GetBuffFromName(const std::string & name, CCBot & bot)
 {
-    for (const sc2::BuffData & data : bot.Observation()->GetBuffData())
-    {
-        if (name == data.name)
-        {
-            return data.buff_id;
-        }
-    }
-
-    return 0;
+    return sc2::BuffID(bot.Names().getBuffID(name));
 }
 
 sc2::AbilityID Util::GetAbilityFromName(const std::string & name, CCBot & bot)
 {
-    for (const sc2::AbilityData & data : bot.Observation()->GetAbilityData())
-    {
-        if (name == data.link_name)
-        {
-            return data.ability_id;
-        }
-    }
-
-    return 0;
+    return sc2::AbilityID(bot.Names().getAbilityID(name));
 }
 #endif
 
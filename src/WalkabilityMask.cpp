@@ -0,0 +1,45 @@
+#include "WalkabilityMask.h"
+
+WalkabilityMask::WalkabilityMask()
+    : m_width (0)
+    , m_height(0)
+{
+
+}
+
+void WalkabilityMask::build(const Grid2D<bool> & walkable)
+{
+    m_width  = walkable.width();
+    m_height = walkable.height();
+
+    m_walkable.reset(m_width + 2, m_height + 2, false);
+    m_visited .reset(m_width + 2, m_height + 2, false);
+    m_frontier.reset(m_width + 2, m_height + 2, false);
+    m_next    .reset(m_width + 2, m_height + 2, false);
+
+    for (int y(0); y < m_height; ++y)
+    {
+        for (int x(0); x < m_width; ++x)
+        {
+            if (walkable(x, y))
+            {
+                m_walkable.set(x + 1, y + 1, true);
+            }
+        }
+    }
+}
+
+int WalkabilityMask::width() const
+{
+    return m_width;
+}
+
+int WalkabilityMask::height() const
+{
+    return m_height;
+}
+
+bool WalkabilityMask::isWalkable(int tileX, int tileY) const
+{
+    return m_walkable.isValid(tileX + 1, tileY + 1) && m_walkable(tileX + 1, tileY + 1);
+}
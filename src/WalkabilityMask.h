@@ -0,0 +1,132 @@
+#pragma once
+
+#include "Grid2D.h"
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+// Bit-packed walkability mask surrounded by a one tile unwalkable border.
+// Map tile (x, y) is stored at (x + 1, y + 1), so the neighbours of any tile on the map
+// can be read without bounds checks, which is what the BFS kernel below relies on.
+class WalkabilityMask
+{
+    int                     m_width;
+    int                     m_height;
+    Grid2D<bool>            m_walkable;
+
+    // scratch space for the search, kept around so repeated searches do not allocate
+    mutable Grid2D<bool>    m_visited;
+    mutable Grid2D<bool>    m_frontier;
+    mutable Grid2D<bool>    m_next;
+
+public:
+
+    // index of the lowest set bit in a non-zero word
+    static int LowestSetBit(uint64_t word)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward64(&index, word);
+        return (int)index;
+#else
+        return __builtin_ctzll(word);
+#endif
+    }
+
+    WalkabilityMask();
+
+    void    build(const Grid2D<bool> & walkable);
+
+    int     width() const;
+    int     height() const;
+    bool    isWalkable(int tileX, int tileY) const;
+
+    // 4-directional breadth first search over walkable tiles starting from (startX, startY)
+    // calls visit(x, y, distance) once for every reached tile, in order of non-decreasing distance
+    // the start tile itself is always reported with distance 0, even if it is not walkable
+    template <class Visitor>
+    void    breadthFirstSearch(int startX, int startY, Visitor && visit) const;
+};
+
+// Level-synchronous search: each level expands the whole frontier at once, a 64 tile word at a time,
+// by shifting the frontier bits left/right within a row and OR-ing in the rows above and below.
+// Only the rows the frontier can reach on this level are touched.
+template <class Visitor>
+void WalkabilityMask::breadthFirstSearch(int startX, int startY, Visitor && visit) const
+{
+    if (startX < 0 || startY < 0 || startX >= m_width || startY >= m_height)
+    {
+        return;
+    }
+
+    const int words = m_walkable.wordsPerRow();
+
+    m_visited.fill(false);
+    m_frontier.fill(false);
+    m_next.fill(false);
+
+    m_visited.set(startX + 1, startY + 1, true);
+    m_frontier.set(startX + 1, startY + 1, true);
+    visit(startX, startY, 0);
+
+    int minRow = startY + 1;
+    int maxRow = startY + 1;
+
+    for (int distance = 1; minRow <= maxRow; ++distance)
+    {
+        // border rows are never walkable, so only the real rows need to be expanded into
+        const int firstRow = std::max(1, minRow - 1);
+        const int lastRow  = std::min(m_height, maxRow + 1);
+
+        int nextMinRow = std::numeric_limits<int>::max();
+        int nextMaxRow = std::numeric_limits<int>::min();
+
+        for (int r = firstRow; r <= lastRow; ++r)
+        {
+            const uint64_t * below    = m_frontier.row(r - 1);
+            const uint64_t * current  = m_frontier.row(r);
+            const uint64_t * above    = m_frontier.row(r + 1);
+            const uint64_t * walkable = m_walkable.row(r);
+            uint64_t *       visited  = m_visited.row(r);
+            uint64_t *       next     = m_next.row(r);
+
+            for (int w = 0; w < words; ++w)
+            {
+                uint64_t spread = below[w] | above[w] | (current[w] << 1) | (current[w] >> 1);
+                if (w > 0)         { spread |= current[w - 1] >> 63; }
+                if (w + 1 < words) { spread |= current[w + 1] << 63; }
+
+                const uint64_t reached = spread & walkable[w] & ~visited[w];
+                next[w] = reached;
+
+                if (reached == 0)
+                {
+                    continue;
+                }
+
+                visited[w] |= reached;
+                nextMinRow = std::min(nextMinRow, r);
+                nextMaxRow = std::max(nextMaxRow, r);
+
+                for (uint64_t bits = reached; bits != 0; bits &= bits - 1)
+                {
+                    visit(w * 64 + LowestSetBit(bits) - 1, r - 1, distance);
+                }
+            }
+        }
+
+        // wipe the expanded frontier so its buffer can be reused for the level after this one
+        for (int r = minRow; r <= maxRow; ++r)
+        {
+            std::fill(m_frontier.row(r), m_frontier.row(r) + words, 0ull);
+        }
+
+        std::swap(m_frontier, m_next);
+        minRow = nextMinRow;
+        maxRow = nextMaxRow;
+    }
+}
@@ -13,18 +13,37 @@ WorkerData::WorkerData(CCBot & bot)
     }
 }
 
-void WorkerData::updateAllWorkerData()
+void WorkerData::onStart()
 {
-    // check all our units and add new workers if we find them
-    for (auto & unit : m_bot.UnitInfo().getUnits(Players::Self))
+    // the workers we start with are never reported as created, so they are picked up once here
+    for (auto & unit : m_bot.GetUnits())
     {
-        if (unit.getType().isWorker() && unit.isCompleted())
+        if (unit.getPlayer() == Players::Self && unit.getType().isWorker() && unit.isCompleted())
         {
-
             updateWorker(unit);
         }
     }
 
+    // from then on new and dead workers come from the unit events instead of scanning all our units every frame
+    m_bot.Events().subscribe(UnitEvents::Created, [this](const Unit & unit)
+    {
+        if (unit.getPlayer() == Players::Self && unit.getType().isWorker() && unit.isCompleted())
+        {
+            updateWorker(unit);
+        }
+    });
+
+    m_bot.Events().subscribe(UnitEvents::Destroyed, [this](const Unit & unit)
+    {
+        if (m_workers.find(unit) != m_workers.end())
+        {
+            workerDestroyed(unit);
+        }
+    });
+}
+
+void WorkerData::updateAllWorkerData()
+{
     // for each of our Workers
     for (auto worker : getWorkers())
     {
@@ -35,21 +54,6 @@ void WorkerData::updateAllWorkerData()
 		}
 
     }
-
-    // remove any worker units which no longer exist in the game
-    std::vector<Unit> workersDestroyed;
-    for (auto worker : getWorkers())
-    {
-        if (!worker.isValid() && (getWorkerJob(worker) != WorkerJobs::Gas))
-        {
-            workersDestroyed.push_back(worker);
-        }
-    }
-
-    for (auto worker : workersDestroyed)
-    {
-        workerDestroyed(worker);
-    }
 }
 
 void WorkerData::workerDestroyed(const Unit & unit)
@@ -91,7 +95,7 @@ void WorkerData::setWorkerJob(const Unit & unit, int job, Unit jobUnit)
 		//condition that if this is the start of the game, let them be
 		if (startOfGame) {
 			for (auto unit : m_bot.UnitInfo().getUnits(Players::Self)) {
-				if (unit.getType().getName() == "TERRAN_SUPPLYDEPOT") {
+				if (unit.getType().is(sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOT)) {
 					startOfGame = false;
 				}
 			}
@@ -188,23 +192,10 @@ int WorkerData::getWorkerJob(const Unit & unit) const
 
 Unit WorkerData::getMineralToMine(const Unit & unit, const Unit & jobUnit) const
 {
-    Unit bestMineral;
-    double bestDist = 100000;
-
-    for (auto & mineral : m_bot.GetUnits())
-    {
-        if (!mineral.getType().isMineral()) continue;
-
-        double dist = Util::Dist(mineral, jobUnit);
-
-        if (dist < bestDist)
-        {
-            bestMineral = mineral;
-            bestDist = dist;
-        }
-    }
+    auto isMineral = [](const Unit & mineral) { return mineral.getType().isMineral(); };
 
-    return bestMineral;
+    const std::vector<Unit> closest = m_bot.Spatial().nearest(jobUnit.getPosition(), 1, Players::Neutral, SpatialLayers::Ground, isMineral, 100000);
+    return closest.empty() ? Unit() : closest.front();
 }
 
 Unit WorkerData::getWorkerDepot(const Unit & unit) const
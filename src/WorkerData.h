@@ -1,6 +1,7 @@
 #pragma once
 #include "Common.h"
 #include "Unit.h"
+#include "FlatUnitMap.h"
 
 class CCBot;
 
@@ -16,11 +17,11 @@ class WorkerData
     std::set<Unit>          m_workers;
     std::set<Unit>          m_depots;
     std::map<int, int>      m_workerJobCount;
-    std::map<Unit, int>     m_workerJobMap;
-    std::map<Unit, int>     m_refineryWorkerCount;
-    std::map<Unit, int>     m_depotWorkerCount;
-    std::map<Unit, Unit>    m_workerRefineryMap;
-    std::map<Unit, Unit>    m_workerDepotMap;
+    FlatUnitMap<Unit, int>  m_workerJobMap;
+    FlatUnitMap<Unit, int>  m_refineryWorkerCount;
+    FlatUnitMap<Unit, int>  m_depotWorkerCount;
+    FlatUnitMap<Unit, Unit> m_workerRefineryMap;
+    FlatUnitMap<Unit, Unit> m_workerDepotMap;
 
 	bool startOfGame = true;
 
@@ -30,6 +31,8 @@ public:
 
     WorkerData(CCBot & bot);
 
+    void    onStart();
+
     void    workerDestroyed(const Unit & unit);
     void    updateAllWorkerData();
     void    updateWorker(const Unit & unit);
@@ -12,6 +12,7 @@ WorkerManager::WorkerManager(CCBot & bot)
 
 void WorkerManager::onStart()
 {
+    m_workerData.onStart();
 }
 
 void WorkerManager::onFrame()